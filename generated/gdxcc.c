@@ -1003,7 +1003,7 @@ int  GDX_CALLCONV d_gdxOpenRead (gdxHandle_t pgdx, const char *FileName, int *Er
 /** Open a GDX file for reading allowing for skipping sections. Non-zero if the file can be opened, zero otherwise.
  * @param pgdx gdx object handle
  * @param FileName File name of the GDX file to be opened (arbitrary length).
- * @param ReadMode Bitmap skip reading sections: 0-bit: string (1 skip reading string).
+ * @param ReadMode Bitmap skip reading sections: 0-bit: string (1 skip reading string), 1-bit: header only (2 defers reading the UEL, set text and acronym sections until they are needed).
  * @param ErrNr Returns an error code or zero if there is no error.
  */
 int  GDX_CALLCONV d_gdxOpenReadEx (gdxHandle_t pgdx, const char *FileName, int ReadMode, int *ErrNr)
@@ -1476,6 +1476,126 @@ int  GDX_CALLCONV d_gdxRenameUEL (gdxHandle_t pgdx, const char *OldName, const c
   printAndReturn(gdxRenameUEL,2,int )
 }
 
+/** Initialize the reading of a symbol in raw mode like gdxDataReadRawStart but returns the number of records as 64 bit integer, so it can be used for symbols with more than 2^31-1 records. Returns zero if the operation is not possible.
+ * @param pgdx gdx object handle
+ * @param SyNr The index number of the symbol, range 0..NrSymbols; SyNr = 0 reads universe.
+ * @param NrRecs The maximum number of records available for reading as 64 bit integer. The actual number of records may be less when a filter is applied to the records read.
+ */
+int  GDX_CALLCONV d_gdxDataReadRawStart64 (gdxHandle_t pgdx, int SyNr, INT64 *NrRecs)
+{
+  int d_s[]={3,3,24};
+  GAMS_UNUSED(pgdx)
+  GAMS_UNUSED(SyNr)
+  GAMS_UNUSED(NrRecs)
+  printAndReturn(gdxDataReadRawStart64,2,int )
+}
+
+/** Initialize the reading of a symbol in mapped mode like gdxDataReadMapStart but returns the number of records as 64 bit integer, so it can be used for symbols with more than 2^31-1 records. Returns zero if the operation is not possible.
+ * @param pgdx gdx object handle
+ * @param SyNr The index number of the symbol, range 0..NrSymbols; SyNr = 0 reads universe.
+ * @param NrRecs The maximum number of records available for reading as 64 bit integer. The actual number of records may be less when a filter is applied to the records read.
+ */
+int  GDX_CALLCONV d_gdxDataReadMapStart64 (gdxHandle_t pgdx, int SyNr, INT64 *NrRecs)
+{
+  int d_s[]={3,3,24};
+  GAMS_UNUSED(pgdx)
+  GAMS_UNUSED(SyNr)
+  GAMS_UNUSED(NrRecs)
+  printAndReturn(gdxDataReadMapStart64,2,int )
+}
+
+/** Initialize the reading of a symbol in string mode like gdxDataReadStrStart but returns the number of records as 64 bit integer, so it can be used for symbols with more than 2^31-1 records. Returns zero if the operation is not possible.
+ * @param pgdx gdx object handle
+ * @param SyNr The index number of the symbol, range 0..NrSymbols; SyNr = 0 reads universe.
+ * @param NrRecs The number of records available for reading as 64 bit integer.
+ */
+int  GDX_CALLCONV d_gdxDataReadStrStart64 (gdxHandle_t pgdx, int SyNr, INT64 *NrRecs)
+{
+  int d_s[]={3,3,24};
+  GAMS_UNUSED(pgdx)
+  GAMS_UNUSED(SyNr)
+  GAMS_UNUSED(NrRecs)
+  printAndReturn(gdxDataReadStrStart64,2,int )
+}
+
+/** Returns additional information about a symbol like gdxSymbolInfoX but with the record count as 64 bit integer. Returns zero if the symbol number is out of range, non-zero otherwise.
+ * @param pgdx gdx object handle
+ * @param SyNr The symbol number (range 0..NrSymbols); return universe info when SyNr = 0.
+ * @param RecCnt Total number of records stored (unmapped) as 64 bit integer; for the universe (SyNr = 0) this is the number of entries when the GDX file was opened for reading.
+ * @param UserInfo User field value storing additional data (see gdxSymbolInfoX).
+ * @param ExplTxt Explanatory text for the symbol. Buffer for this output argument should be 256 bytes long.
+ */
+int  GDX_CALLCONV d_gdxSymbolInfoX64 (gdxHandle_t pgdx, int SyNr, INT64 *RecCnt, int *UserInfo, char *ExplTxt)
+{
+  int d_s[]={3,3,24,4,12};
+  GAMS_UNUSED(pgdx)
+  GAMS_UNUSED(SyNr)
+  GAMS_UNUSED(RecCnt)
+  GAMS_UNUSED(UserInfo)
+  GAMS_UNUSED(ExplTxt)
+  printAndReturn(gdxSymbolInfoX64,4,int )
+}
+
+/** Query the number of error records of the current symbol that were only counted because the error list was full (see gdxDataErrorLimit).
+ * @param pgdx gdx object handle
+ */
+int  GDX_CALLCONV d_gdxDataErrorOverflowCount (gdxHandle_t pgdx)
+{
+  int d_s[]={3};
+  GAMS_UNUSED(pgdx)
+  printAndReturn(gdxDataErrorOverflowCount,0,int )
+}
+
+/** Retrieve a range of error records at once like gdxDataErrorRecordX. Returns the number of records retrieved.
+ * @param pgdx gdx object handle
+ * @param RecNr The number of the first record to be retrieved (range 1..NrErrorRecords).
+ * @param Cnt The maximum number of records to be retrieved.
+ * @param KeyInt Indices of the records, one UEL index per dimension for each record one after the other; negative uel indicates domain violation for filtered/strict read.
+ * @param Values Values of the records, five values (level, marginal, lower-, upper-bound, scale) for each record one after the other.
+ */
+int  GDX_CALLCONV d_gdxDataErrorRecords (gdxHandle_t pgdx, int RecNr, int Cnt, int KeyInt[], double Values[])
+{
+  int d_s[]={3,3,3,52,54};
+  GAMS_UNUSED(pgdx)
+  GAMS_UNUSED(RecNr)
+  GAMS_UNUSED(Cnt)
+  GAMS_UNUSED(KeyInt)
+  GAMS_UNUSED(Values)
+  printAndReturn(gdxDataErrorRecords,4,int )
+}
+
+/** Retrieve the fingerprint of the records of a symbol stored when the file was written (see gdxStoreFingerprints). The fingerprint does not depend on the UEL numbering of the file. Symbols with different fingerprints have different records; symbols with the same fingerprint almost certainly have the same records, but as for any 64 bit hash different records can collide. Returns zero if the file holds no fingerprint for the symbol.
+ * @param pgdx gdx object handle
+ * @param SyNr The symbol number (range 1..NrSymbols); an alias gives the fingerprint of the aliased set.
+ * @param Fingerprint The fingerprint as 16 hexadecimal digits, empty if not available.
+ */
+int  GDX_CALLCONV d_gdxSymbolFingerprint (gdxHandle_t pgdx, int SyNr, char *Fingerprint)
+{
+  int d_s[]={3,3,12};
+  GAMS_UNUSED(pgdx)
+  GAMS_UNUSED(SyNr)
+  GAMS_UNUSED(Fingerprint)
+  printAndReturn(gdxSymbolFingerprint,2,int )
+}
+
+/** Copy a range of the data of a symbol as stored in the file, without decoding the records. Comparing these bytes range by range tells whether two symbols are stored identically; this implies the same records only if both files have the same UEL table, set texts and acronyms. Returns the number of bytes copied, which is less than Count once the end of the data is reached.
+ * @param pgdx gdx object handle
+ * @param SyNr The symbol number (range 1..NrSymbols); an alias gives the data of the aliased set.
+ * @param Offset Position of the first byte to copy, relative to the start of the data of the symbol.
+ * @param Count The maximum number of bytes to copy.
+ * @param Buffer Receives the bytes; must be able to hold Count bytes.
+ */
+int  GDX_CALLCONV d_gdxSymbolDataBytes (gdxHandle_t pgdx, int SyNr, INT64 Offset, int Count, void *Buffer)
+{
+  int d_s[]={3,3,23,3,1};
+  GAMS_UNUSED(pgdx)
+  GAMS_UNUSED(SyNr)
+  GAMS_UNUSED(Offset)
+  GAMS_UNUSED(Count)
+  GAMS_UNUSED(Buffer)
+  printAndReturn(gdxSymbolDataBytes,4,int )
+}
+
 /** Get flag to store one dimensional sets as potential domains, false (0) saves lots of space for large 1-dim sets that are no domains but can create inconsistent GDX files if used incorrectly. Returns 1 (true) iff. elements of 1-dim sets should be tracked for domain checking, 0 (false) otherwise.
  * @param pgdx gdx object handle
  */
@@ -1539,6 +1659,69 @@ void GDX_CALLCONV d_gdxMapAcronymsToNaNSet (gdxHandle_t pgdx,const int x)
   printNoReturn(gdxMapAcronymsToNaNSet,1)
 }
 
+/** Get flag to store the major index of the next file opened for writing in a fixed-size trailer at the end of the file instead of patching it into the header on close. Such files are written strictly append-only, so they can be written to sinks that do not support seeking (pipes etc.). Disabled by default.
+ * @param pgdx gdx object handle
+ */
+int  GDX_CALLCONV d_gdxFooterIndex (gdxHandle_t pgdx)
+{
+  int d_s[]={15};
+  GAMS_UNUSED(pgdx)
+  printAndReturn(gdxFooterIndex,0,int )
+}
+
+/** Set flag to store the major index of the next file opened for writing in a fixed-size trailer at the end of the file instead of patching it into the header on close. Such files are written strictly append-only, so they can be written to sinks that do not support seeking (pipes etc.). Readers detect this variant from the file header. Files written this way cannot be read by GDX libraries that predate this option. Disabled by default.
+ * @param pgdx gdx object handle
+ */
+void GDX_CALLCONV d_gdxFooterIndexSet (gdxHandle_t pgdx,const int x)
+{
+  int d_s[]={0,15};
+  GAMS_UNUSED(pgdx)
+  GAMS_UNUSED(x)
+  printNoReturn(gdxFooterIndexSet,1)
+}
+
+/** Get the maximum number of error records stored per symbol (see gdxDataErrorCount). Further error records are only counted (see gdxDataErrorOverflowCount). A negative value means no limit. The default is 11.
+ * @param pgdx gdx object handle
+ */
+int  GDX_CALLCONV d_gdxDataErrorLimit (gdxHandle_t pgdx)
+{
+  int d_s[]={3};
+  GAMS_UNUSED(pgdx)
+  printAndReturn(gdxDataErrorLimit,0,int )
+}
+
+/** Set the maximum number of error records stored per symbol (see gdxDataErrorCount). Further error records are only counted (see gdxDataErrorOverflowCount). A negative value means no limit. The default is 11.
+ * @param pgdx gdx object handle
+ */
+void GDX_CALLCONV d_gdxDataErrorLimitSet (gdxHandle_t pgdx,const int x)
+{
+  int d_s[]={0,3};
+  GAMS_UNUSED(pgdx)
+  GAMS_UNUSED(x)
+  printNoReturn(gdxDataErrorLimitSet,1)
+}
+
+/** Get flag to compute a fingerprint of the records of every symbol written and store it in the file. Disabled by default.
+ * @param pgdx gdx object handle
+ */
+int  GDX_CALLCONV d_gdxStoreFingerprints (gdxHandle_t pgdx)
+{
+  int d_s[]={15};
+  GAMS_UNUSED(pgdx)
+  printAndReturn(gdxStoreFingerprints,0,int )
+}
+
+/** Set flag to compute a fingerprint of the records of every symbol written and store it in the file. The fingerprint is a hash over the UEL strings, set texts and values of the records, so it does not depend on the UEL numbering or record order of the file (see gdxSymbolFingerprint). Files written this way remain readable by older GDX libraries. Disabled by default.
+ * @param pgdx gdx object handle
+ */
+void GDX_CALLCONV d_gdxStoreFingerprintsSet (gdxHandle_t pgdx,const int x)
+{
+  int d_s[]={0,15};
+  GAMS_UNUSED(pgdx)
+  GAMS_UNUSED(x)
+  printNoReturn(gdxStoreFingerprintsSet,1)
+}
+
 
 /** return dirName on success, NULL on failure */
 static char *
@@ -1901,12 +2084,26 @@ XLibraryLoad (const char *dllName, char *errBuf, int errBufSize)
   {int s[]={3,3,3,3,59,4,1}; CheckAndLoad(gdxGetDomainElements,6,"C__"); }
   {int s[]={3}; CheckAndLoad(gdxCurrentDim,0,"C__"); }
   {int s[]={3,11,11}; CheckAndLoad(gdxRenameUEL,2,"C__"); }
+  {int s[]={3,3,24}; CheckAndLoad(gdxDataReadRawStart64,2,"C__"); }
+  {int s[]={3,3,24}; CheckAndLoad(gdxDataReadMapStart64,2,"C__"); }
+  {int s[]={3,3,24}; CheckAndLoad(gdxDataReadStrStart64,2,"C__"); }
+  {int s[]={3,3,24,4,12}; CheckAndLoad(gdxSymbolInfoX64,4,"C__"); }
+  {int s[]={3}; CheckAndLoad(gdxDataErrorOverflowCount,0,"C__"); }
+  {int s[]={3,3,3,52,54}; CheckAndLoad(gdxDataErrorRecords,4,"C__"); }
+  {int s[]={3,3,12}; CheckAndLoad(gdxSymbolFingerprint,2,"C__"); }
+  {int s[]={3,3,23,3,1}; CheckAndLoad(gdxSymbolDataBytes,4,"C__"); }
   {int s[]={15}; CheckAndLoad(gdxStoreDomainSets,0,"C__"); }
   {int s[]={0,15}; CheckAndLoad(gdxStoreDomainSetsSet,1,"C__"); }
   {int s[]={15}; CheckAndLoad(gdxAllowBogusDomains,0,"C__"); }
   {int s[]={0,15}; CheckAndLoad(gdxAllowBogusDomainsSet,1,"C__"); }
   {int s[]={15}; CheckAndLoad(gdxMapAcronymsToNaN,0,"C__"); }
   {int s[]={0,15}; CheckAndLoad(gdxMapAcronymsToNaNSet,1,"C__"); }
+  {int s[]={15}; CheckAndLoad(gdxFooterIndex,0,"C__"); }
+  {int s[]={0,15}; CheckAndLoad(gdxFooterIndexSet,1,"C__"); }
+  {int s[]={3}; CheckAndLoad(gdxDataErrorLimit,0,"C__"); }
+  {int s[]={0,3}; CheckAndLoad(gdxDataErrorLimitSet,1,"C__"); }
+  {int s[]={15}; CheckAndLoad(gdxStoreFingerprints,0,"C__"); }
+  {int s[]={0,15}; CheckAndLoad(gdxStoreFingerprintsSet,1,"C__"); }
 
  return 0;
 
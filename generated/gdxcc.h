@@ -234,12 +234,26 @@ int  GDX_CALLCONV d_gdxUMUelInfo (gdxHandle_t pgdx, int *UelCnt, int *HighMap);
 int  GDX_CALLCONV d_gdxGetDomainElements (gdxHandle_t pgdx, int SyNr, int DimPos, int FilterNr, TDomainIndexProc_t DP, int *NrElem, void *Uptr);
 int  GDX_CALLCONV d_gdxCurrentDim (gdxHandle_t pgdx);
 int  GDX_CALLCONV d_gdxRenameUEL (gdxHandle_t pgdx, const char *OldName, const char *NewName);
+int  GDX_CALLCONV d_gdxDataReadRawStart64 (gdxHandle_t pgdx, int SyNr, INT64 *NrRecs);
+int  GDX_CALLCONV d_gdxDataReadMapStart64 (gdxHandle_t pgdx, int SyNr, INT64 *NrRecs);
+int  GDX_CALLCONV d_gdxDataReadStrStart64 (gdxHandle_t pgdx, int SyNr, INT64 *NrRecs);
+int  GDX_CALLCONV d_gdxSymbolInfoX64 (gdxHandle_t pgdx, int SyNr, INT64 *RecCnt, int *UserInfo, char *ExplTxt);
+int  GDX_CALLCONV d_gdxDataErrorOverflowCount (gdxHandle_t pgdx);
+int  GDX_CALLCONV d_gdxDataErrorRecords (gdxHandle_t pgdx, int RecNr, int Cnt, int KeyInt[], double Values[]);
+int  GDX_CALLCONV d_gdxSymbolFingerprint (gdxHandle_t pgdx, int SyNr, char *Fingerprint);
+int  GDX_CALLCONV d_gdxSymbolDataBytes (gdxHandle_t pgdx, int SyNr, INT64 Offset, int Count, void *Buffer);
 int  GDX_CALLCONV d_gdxStoreDomainSets (gdxHandle_t pgdx);
 void GDX_CALLCONV d_gdxStoreDomainSetsSet (gdxHandle_t pgdx, const int x);
 int  GDX_CALLCONV d_gdxAllowBogusDomains (gdxHandle_t pgdx);
 void GDX_CALLCONV d_gdxAllowBogusDomainsSet (gdxHandle_t pgdx, const int x);
 int  GDX_CALLCONV d_gdxMapAcronymsToNaN (gdxHandle_t pgdx);
 void GDX_CALLCONV d_gdxMapAcronymsToNaNSet (gdxHandle_t pgdx, const int x);
+int  GDX_CALLCONV d_gdxFooterIndex (gdxHandle_t pgdx);
+void GDX_CALLCONV d_gdxFooterIndexSet (gdxHandle_t pgdx, const int x);
+int  GDX_CALLCONV d_gdxDataErrorLimit (gdxHandle_t pgdx);
+void GDX_CALLCONV d_gdxDataErrorLimitSet (gdxHandle_t pgdx, const int x);
+int  GDX_CALLCONV d_gdxStoreFingerprints (gdxHandle_t pgdx);
+void GDX_CALLCONV d_gdxStoreFingerprintsSet (gdxHandle_t pgdx, const int x);
 
 
 typedef int  (GDX_CALLCONV *gdxAcronymAdd_t) (gdxHandle_t pgdx, const char *AName, const char *Txt, int AIndx);
@@ -375,7 +389,7 @@ typedef int  (GDX_CALLCONV *gdxDataErrorCount_t) (gdxHandle_t pgdx);
 /** Query the number of error records.
  *
  * @param pgdx gdx object handle
- * @return The number of error records available.
+ * @return The number of error records available, capped at the largest int value.
  */
 GDX_FUNCPTR(gdxDataErrorCount);
 
@@ -819,7 +833,7 @@ typedef int  (GDX_CALLCONV *gdxOpenReadEx_t) (gdxHandle_t pgdx, const char *File
  *
  * @param pgdx gdx object handle
  * @param FileName File name of the GDX file to be opened (arbitrary length).
- * @param ReadMode Bitmap skip reading sections: 0-bit: string (1 skip reading string).
+ * @param ReadMode Bitmap skip reading sections: 0-bit: string (1 skip reading string), 1-bit: header only (2 defers reading the UEL, set text and acronym sections until they are needed).
  * @param ErrNr Returns an error code or zero if there is no error.
  * @return Returns non-zero if the file can be opened; zero otherwise.
  */
@@ -1157,6 +1171,90 @@ typedef int  (GDX_CALLCONV *gdxRenameUEL_t) (gdxHandle_t pgdx, const char *OldNa
  */
 GDX_FUNCPTR(gdxRenameUEL);
 
+typedef int  (GDX_CALLCONV *gdxDataReadRawStart64_t) (gdxHandle_t pgdx, int SyNr, INT64 *NrRecs);
+/** Initialize the reading of a symbol in raw mode like gdxDataReadRawStart but returns the number of records as 64 bit integer, so it can be used for symbols with more than 2^31-1 records. Returns zero if the operation is not possible.
+ *
+ * @param pgdx gdx object handle
+ * @param SyNr The index number of the symbol, range 0..NrSymbols; SyNr = 0 reads universe.
+ * @param NrRecs The maximum number of records available for reading as 64 bit integer. The actual number of records may be less when a filter is applied to the records read.
+ * @return Non-zero if the operation is possible, zero otherwise.
+ */
+GDX_FUNCPTR(gdxDataReadRawStart64);
+
+typedef int  (GDX_CALLCONV *gdxDataReadMapStart64_t) (gdxHandle_t pgdx, int SyNr, INT64 *NrRecs);
+/** Initialize the reading of a symbol in mapped mode like gdxDataReadMapStart but returns the number of records as 64 bit integer, so it can be used for symbols with more than 2^31-1 records. Returns zero if the operation is not possible.
+ *
+ * @param pgdx gdx object handle
+ * @param SyNr The index number of the symbol, range 0..NrSymbols; SyNr = 0 reads universe.
+ * @param NrRecs The maximum number of records available for reading as 64 bit integer. The actual number of records may be less when a filter is applied to the records read.
+ * @return Non-zero if the operation is possible, zero otherwise.
+ */
+GDX_FUNCPTR(gdxDataReadMapStart64);
+
+typedef int  (GDX_CALLCONV *gdxDataReadStrStart64_t) (gdxHandle_t pgdx, int SyNr, INT64 *NrRecs);
+/** Initialize the reading of a symbol in string mode like gdxDataReadStrStart but returns the number of records as 64 bit integer, so it can be used for symbols with more than 2^31-1 records. Returns zero if the operation is not possible.
+ *
+ * @param pgdx gdx object handle
+ * @param SyNr The index number of the symbol, range 0..NrSymbols; SyNr = 0 reads universe.
+ * @param NrRecs The number of records available for reading as 64 bit integer.
+ * @return Non-zero if the operation is possible, zero otherwise.
+ */
+GDX_FUNCPTR(gdxDataReadStrStart64);
+
+typedef int  (GDX_CALLCONV *gdxSymbolInfoX64_t) (gdxHandle_t pgdx, int SyNr, INT64 *RecCnt, int *UserInfo, char *ExplTxt);
+/** Returns additional information about a symbol like gdxSymbolInfoX but with the record count as 64 bit integer. Returns zero if the symbol number is out of range, non-zero otherwise.
+ *
+ * @param pgdx gdx object handle
+ * @param SyNr The symbol number (range 0..NrSymbols); return universe info when SyNr = 0.
+ * @param RecCnt Total number of records stored (unmapped) as 64 bit integer; for the universe (SyNr = 0) this is the number of entries when the GDX file was opened for reading.
+ * @param UserInfo User field value storing additional data (see gdxSymbolInfoX).
+ * @param ExplTxt Explanatory text for the symbol. Buffer for this output argument should be 256 bytes long.
+ * @return Zero if the symbol number is not in the correct range, non-zero otherwise.
+ */
+GDX_FUNCPTR(gdxSymbolInfoX64);
+
+typedef int  (GDX_CALLCONV *gdxDataErrorOverflowCount_t) (gdxHandle_t pgdx);
+/** Query the number of error records of the current symbol that were only counted because the error list was full (see gdxDataErrorLimit).
+ *
+ * @param pgdx gdx object handle
+ * @return The number of error records not stored because of the error record limit, capped at the largest int value.
+ */
+GDX_FUNCPTR(gdxDataErrorOverflowCount);
+
+typedef int  (GDX_CALLCONV *gdxDataErrorRecords_t) (gdxHandle_t pgdx, int RecNr, int Cnt, int KeyInt[], double Values[]);
+/** Retrieve a range of error records at once like gdxDataErrorRecordX. Returns the number of records retrieved.
+ *
+ * @param pgdx gdx object handle
+ * @param RecNr The number of the first record to be retrieved (range 1..NrErrorRecords).
+ * @param Cnt The maximum number of records to be retrieved.
+ * @param KeyInt Indices of the records, one UEL index per dimension for each record one after the other; negative uel indicates domain violation for filtered/strict read.
+ * @param Values Values of the records, GMS_VAL_MAX (=5) values (level, marginal, lower-, upper-bound, scale) for each record one after the other, i.e. the values of the i-th record retrieved start at Values[i*GMS_VAL_MAX].
+ * @return The number of records retrieved, zero if the record number is out of range.
+ */
+GDX_FUNCPTR(gdxDataErrorRecords);
+
+typedef int  (GDX_CALLCONV *gdxSymbolFingerprint_t) (gdxHandle_t pgdx, int SyNr, char *Fingerprint);
+/** Retrieve the fingerprint of the records of a symbol stored when the file was written (see gdxStoreFingerprints). The fingerprint does not depend on the UEL numbering of the file. Symbols with different fingerprints have different records; symbols with the same fingerprint almost certainly have the same records, but as for any 64 bit hash different records can collide. Returns zero if the file holds no fingerprint for the symbol.
+ *
+ * @param pgdx gdx object handle
+ * @param SyNr The symbol number (range 1..NrSymbols); an alias gives the fingerprint of the aliased set.
+ * @param Fingerprint The fingerprint as 16 hexadecimal digits, empty if not available.
+ * @return Non-zero if the symbol has a fingerprint, zero otherwise.
+ */
+GDX_FUNCPTR(gdxSymbolFingerprint);
+
+typedef int  (GDX_CALLCONV *gdxSymbolDataBytes_t) (gdxHandle_t pgdx, int SyNr, INT64 Offset, int Count, void *Buffer);
+/** Copy a range of the data of a symbol as stored in the file, without decoding the records. Comparing these bytes range by range tells whether two symbols are stored identically; this implies the same records only if both files have the same UEL table, set texts and acronyms. Returns the number of bytes copied, which is less than Count once the end of the data is reached.
+ *
+ * @param pgdx gdx object handle
+ * @param SyNr The symbol number (range 1..NrSymbols); an alias gives the data of the aliased set.
+ * @param Offset Position of the first byte to copy, relative to the start of the data of the symbol.
+ * @param Count The maximum number of bytes to copy.
+ * @param Buffer Receives the bytes; must be able to hold Count bytes.
+ * @return The number of bytes copied, zero if Offset is at or behind the end of the data, -1 if the symbol has no stored data or a read is in progress.
+ */
+GDX_FUNCPTR(gdxSymbolDataBytes);
+
 typedef int  (GDX_CALLCONV *gdxStoreDomainSets_t) (gdxHandle_t pgdx);
 /** Get flag to store one dimensional sets as potential domains, false (0) saves lots of space for large 1-dim sets that are no domains but can create inconsistent GDX files if used incorrectly. Returns 1 (true) iff. elements of 1-dim sets should be tracked for domain checking, 0 (false) otherwise.
  *
@@ -1187,6 +1285,28 @@ GDX_FUNCPTR(gdxMapAcronymsToNaN);
 typedef void (GDX_CALLCONV *gdxMapAcronymsToNaNSet_t) (gdxHandle_t pgdx, const int x);
 GDX_FUNCPTR(gdxMapAcronymsToNaNSet);
 
+typedef int  (GDX_CALLCONV *gdxFooterIndex_t) (gdxHandle_t pgdx);
+/** Get flag to store the major index of the next file opened for writing in a fixed-size trailer at the end of the file instead of patching it into the header on close. Such files are written strictly append-only, so they can be written to sinks that do not support seeking (pipes etc.). Disabled by default.
+ *
+ * @param pgdx gdx object handle
+ */
+GDX_FUNCPTR(gdxFooterIndex);
+
+typedef void (GDX_CALLCONV *gdxFooterIndexSet_t) (gdxHandle_t pgdx, const int x);
+GDX_FUNCPTR(gdxFooterIndexSet);
+
+typedef int  (GDX_CALLCONV *gdxDataErrorLimit_t) (gdxHandle_t pgdx);
+GDX_FUNCPTR(gdxDataErrorLimit);
+
+typedef void (GDX_CALLCONV *gdxDataErrorLimitSet_t) (gdxHandle_t pgdx, const int x);
+GDX_FUNCPTR(gdxDataErrorLimitSet);
+
+typedef int  (GDX_CALLCONV *gdxStoreFingerprints_t) (gdxHandle_t pgdx);
+GDX_FUNCPTR(gdxStoreFingerprints);
+
+typedef void (GDX_CALLCONV *gdxStoreFingerprintsSet_t) (gdxHandle_t pgdx, const int x);
+GDX_FUNCPTR(gdxStoreFingerprintsSet);
+
 #if defined(__cplusplus)
 }
 #endif
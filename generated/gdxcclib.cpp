@@ -154,6 +154,14 @@
 #define C__gdxGetDomainElements c__gdxgetdomainelements
 #define C__gdxCurrentDim c__gdxcurrentdim
 #define C__gdxRenameUEL c__gdxrenameuel
+#define C__gdxDataReadRawStart64 c__gdxdatareadrawstart64
+#define C__gdxDataReadMapStart64 c__gdxdatareadmapstart64
+#define C__gdxDataReadStrStart64 c__gdxdatareadstrstart64
+#define C__gdxSymbolInfoX64 c__gdxsymbolinfox64
+#define C__gdxDataErrorOverflowCount c__gdxdataerroroverflowcount
+#define C__gdxDataErrorRecords c__gdxdataerrorrecords
+#define C__gdxSymbolFingerprint c__gdxsymbolfingerprint
+#define C__gdxSymbolDataBytes c__gdxsymboldatabytes
 #define D__gdxAcronymAdd d__gdxacronymadd
 #define D__gdxAcronymGetInfo d__gdxacronymgetinfo
 #define D__gdxAcronymName d__gdxacronymname
@@ -194,6 +202,7 @@
 #define D__gdxUMFindUEL d__gdxumfinduel
 #define D__gdxUMUelGet d__gdxumuelget
 #define D__gdxRenameUEL d__gdxrenameuel
+#define D__gdxSymbolInfoX64 d__gdxsymbolinfox64
 #define N__gdxDataReadStr n__gdxdatareadstr
 #define N__gdxDataSliceUELS n__gdxdatasliceuels
 #define N__gdxSymbolGetDomainX n__gdxsymbolgetdomainx
@@ -208,6 +217,12 @@
 #define C__gdxAllowBogusDomainsSet c__gdxallowbogusdomainsset
 #define C__gdxMapAcronymsToNaN c__gdxmapacronymstonan
 #define C__gdxMapAcronymsToNaNSet c__gdxmapacronymstonanset
+#define C__gdxFooterIndex c__gdxfooterindex
+#define C__gdxFooterIndexSet c__gdxfooterindexset
+#define C__gdxDataErrorLimit c__gdxdataerrorlimit
+#define C__gdxDataErrorLimitSet c__gdxdataerrorlimitset
+#define C__gdxStoreFingerprints c__gdxstorefingerprints
+#define C__gdxStoreFingerprintsSet c__gdxstorefingerprintsset
 
 
 /* declarations shut up compiler warnings */
@@ -874,6 +889,46 @@ GDX_API int GDX_CALLCONV C__XCheck(const char *funcn, int ClNrArg, int Clsign[],
     DLLsign[0] = 3;DLLsign[1] = 11;DLLsign[2] = 11;
     return CheckSign(funcn,2,ClNrArg,DLLsign,Clsign,Msg);
   }
+  else if(!strcmp(funcn,"gdxDataReadRawStart64"))
+  {
+    DLLsign[0] = 3;DLLsign[1] = 3;DLLsign[2] = 24;
+    return CheckSign(funcn,2,ClNrArg,DLLsign,Clsign,Msg);
+  }
+  else if(!strcmp(funcn,"gdxDataReadMapStart64"))
+  {
+    DLLsign[0] = 3;DLLsign[1] = 3;DLLsign[2] = 24;
+    return CheckSign(funcn,2,ClNrArg,DLLsign,Clsign,Msg);
+  }
+  else if(!strcmp(funcn,"gdxDataReadStrStart64"))
+  {
+    DLLsign[0] = 3;DLLsign[1] = 3;DLLsign[2] = 24;
+    return CheckSign(funcn,2,ClNrArg,DLLsign,Clsign,Msg);
+  }
+  else if(!strcmp(funcn,"gdxSymbolInfoX64"))
+  {
+    DLLsign[0] = 3;DLLsign[1] = 3;DLLsign[2] = 24;DLLsign[3] = 4;DLLsign[4] = 12;
+    return CheckSign(funcn,4,ClNrArg,DLLsign,Clsign,Msg);
+  }
+  else if(!strcmp(funcn,"gdxDataErrorOverflowCount"))
+  {
+    DLLsign[0] = 3;
+    return CheckSign(funcn,0,ClNrArg,DLLsign,Clsign,Msg);
+  }
+  else if(!strcmp(funcn,"gdxDataErrorRecords"))
+  {
+    DLLsign[0] = 3;DLLsign[1] = 3;DLLsign[2] = 3;DLLsign[3] = 52;DLLsign[4] = 54;
+    return CheckSign(funcn,4,ClNrArg,DLLsign,Clsign,Msg);
+  }
+  else if(!strcmp(funcn,"gdxSymbolFingerprint"))
+  {
+    DLLsign[0] = 3;DLLsign[1] = 3;DLLsign[2] = 12;
+    return CheckSign(funcn,2,ClNrArg,DLLsign,Clsign,Msg);
+  }
+  else if(!strcmp(funcn,"gdxSymbolDataBytes"))
+  {
+    DLLsign[0] = 3;DLLsign[1] = 3;DLLsign[2] = 23;DLLsign[3] = 3;DLLsign[4] = 1;
+    return CheckSign(funcn,4,ClNrArg,DLLsign,Clsign,Msg);
+  }
   else if(!strcmp(funcn,"gdxStoreDomainSets"))
   {
     DLLsign[0] = 15;
@@ -904,6 +959,36 @@ GDX_API int GDX_CALLCONV C__XCheck(const char *funcn, int ClNrArg, int Clsign[],
     DLLsign[0] = 0; DLLsign[1] = 15;
     return CheckSign(funcn,1,ClNrArg,DLLsign,Clsign,Msg);
   }
+  else if(!strcmp(funcn,"gdxFooterIndex"))
+  {
+    DLLsign[0] = 15;
+    return CheckSign(funcn,0,ClNrArg,DLLsign,Clsign,Msg);
+  }
+  else if(!strcmp(funcn,"gdxFooterIndexSet"))
+  {
+    DLLsign[0] = 0; DLLsign[1] = 15;
+    return CheckSign(funcn,1,ClNrArg,DLLsign,Clsign,Msg);
+  }
+  else if(!strcmp(funcn,"gdxDataErrorLimit"))
+  {
+    DLLsign[0] = 3;
+    return CheckSign(funcn,0,ClNrArg,DLLsign,Clsign,Msg);
+  }
+  else if(!strcmp(funcn,"gdxDataErrorLimitSet"))
+  {
+    DLLsign[0] = 0; DLLsign[1] = 3;
+    return CheckSign(funcn,1,ClNrArg,DLLsign,Clsign,Msg);
+  }
+  else if(!strcmp(funcn,"gdxStoreFingerprints"))
+  {
+    DLLsign[0] = 15;
+    return CheckSign(funcn,0,ClNrArg,DLLsign,Clsign,Msg);
+  }
+  else if(!strcmp(funcn,"gdxStoreFingerprintsSet"))
+  {
+    DLLsign[0] = 0; DLLsign[1] = 15;
+    return CheckSign(funcn,1,ClNrArg,DLLsign,Clsign,Msg);
+  }
   else
   {
     snprintf(Msg,GMS_SSSIZE-1,"gdxcclib: %s cannot be found in library.",funcn);
@@ -1494,6 +1579,54 @@ GDX_API int GDX_CALLCONV C__gdxRenameUEL(TGXFileRec_t *TGXFile, const char *OldN
   return gdxRenameUEL(TGXFile, OldName, NewName);
 }
 
+GDX_API int GDX_CALLCONV C__gdxDataReadRawStart64(TGXFileRec_t *TGXFile, int SyNr, INT64 *NrRecs);
+GDX_API int GDX_CALLCONV C__gdxDataReadRawStart64(TGXFileRec_t *TGXFile, int SyNr, INT64 *NrRecs)
+{
+  return gdxDataReadRawStart64(TGXFile, SyNr, NrRecs);
+}
+
+GDX_API int GDX_CALLCONV C__gdxDataReadMapStart64(TGXFileRec_t *TGXFile, int SyNr, INT64 *NrRecs);
+GDX_API int GDX_CALLCONV C__gdxDataReadMapStart64(TGXFileRec_t *TGXFile, int SyNr, INT64 *NrRecs)
+{
+  return gdxDataReadMapStart64(TGXFile, SyNr, NrRecs);
+}
+
+GDX_API int GDX_CALLCONV C__gdxDataReadStrStart64(TGXFileRec_t *TGXFile, int SyNr, INT64 *NrRecs);
+GDX_API int GDX_CALLCONV C__gdxDataReadStrStart64(TGXFileRec_t *TGXFile, int SyNr, INT64 *NrRecs)
+{
+  return gdxDataReadStrStart64(TGXFile, SyNr, NrRecs);
+}
+
+GDX_API int GDX_CALLCONV C__gdxSymbolInfoX64(TGXFileRec_t *TGXFile, int SyNr, INT64 *RecCnt, int *UserInfo, char *ExplTxt);
+GDX_API int GDX_CALLCONV C__gdxSymbolInfoX64(TGXFileRec_t *TGXFile, int SyNr, INT64 *RecCnt, int *UserInfo, char *ExplTxt)
+{
+  return gdxSymbolInfoX64(TGXFile, SyNr, RecCnt, UserInfo, ExplTxt);
+}
+
+GDX_API int GDX_CALLCONV C__gdxDataErrorOverflowCount(TGXFileRec_t *TGXFile);
+GDX_API int GDX_CALLCONV C__gdxDataErrorOverflowCount(TGXFileRec_t *TGXFile)
+{
+  return gdxDataErrorOverflowCount(TGXFile);
+}
+
+GDX_API int GDX_CALLCONV C__gdxDataErrorRecords(TGXFileRec_t *TGXFile, int RecNr, int Cnt, int KeyInt[], double Values[]);
+GDX_API int GDX_CALLCONV C__gdxDataErrorRecords(TGXFileRec_t *TGXFile, int RecNr, int Cnt, int KeyInt[], double Values[])
+{
+  return gdxDataErrorRecords(TGXFile, RecNr, Cnt, KeyInt, Values);
+}
+
+GDX_API int GDX_CALLCONV C__gdxSymbolFingerprint(TGXFileRec_t *TGXFile, int SyNr, char *Fingerprint);
+GDX_API int GDX_CALLCONV C__gdxSymbolFingerprint(TGXFileRec_t *TGXFile, int SyNr, char *Fingerprint)
+{
+  return gdxSymbolFingerprint(TGXFile, SyNr, Fingerprint);
+}
+
+GDX_API int GDX_CALLCONV C__gdxSymbolDataBytes(TGXFileRec_t *TGXFile, int SyNr, INT64 Offset, int Count, void *Buffer);
+GDX_API int GDX_CALLCONV C__gdxSymbolDataBytes(TGXFileRec_t *TGXFile, int SyNr, INT64 Offset, int Count, void *Buffer)
+{
+  return gdxSymbolDataBytes(TGXFile, SyNr, Offset, Count, Buffer);
+}
+
 GDX_API int GDX_CALLCONV D__gdxAcronymAdd(TGXFileRec_t *TGXFile, const char *AName, const char *Txt, int AIndx);
 GDX_API int GDX_CALLCONV D__gdxAcronymAdd(TGXFileRec_t *TGXFile, const char *AName, const char *Txt, int AIndx)
 {
@@ -2081,6 +2214,19 @@ GDX_API int GDX_CALLCONV D__gdxRenameUEL(TGXFileRec_t *TGXFile, const char *OldN
   return gdxRenameUEL_result;
 }
 
+GDX_API int GDX_CALLCONV D__gdxSymbolInfoX64(TGXFileRec_t *TGXFile, int SyNr, INT64 *RecCnt, int *UserInfo, char *ExplTxt);
+GDX_API int GDX_CALLCONV D__gdxSymbolInfoX64(TGXFileRec_t *TGXFile, int SyNr, INT64 *RecCnt, int *UserInfo, char *ExplTxt)
+{
+  int  gdxSymbolInfoX64_result;
+  char ExplTxt_sst[256];
+  char *ExplTxt_local;
+  gdxSymbolInfoX64_result = gdxSymbolInfoX64(TGXFile, SyNr, RecCnt, UserInfo, ExplTxt_sst);
+  ExplTxt_local = ExplTxt+1;
+  memcpy(ExplTxt_local,ExplTxt_sst,mymin(strlen(ExplTxt_sst),255));
+  ExplTxt[0] = strlen(ExplTxt_sst);
+  return gdxSymbolInfoX64_result;
+}
+
 GDX_API int GDX_CALLCONV N__gdxDataReadStr(TGXFileRec_t *TGXFile, gdxStrIndex_t KeyStr,  double Values[],  int *DimFrst);
 GDX_API int GDX_CALLCONV N__gdxDataReadStr(TGXFileRec_t *TGXFile, gdxStrIndex_t KeyStr,  double Values[],  int *DimFrst)
 {
@@ -2180,5 +2326,41 @@ GDX_API void GDX_CALLCONV C__gdxMapAcronymsToNaNSet(TGXFileRec_t *TGXFile, int x
   gdxMapAcronymsToNaNSet(TGXFile,x);
 }
 
+GDX_API int  GDX_CALLCONV C__gdxFooterIndex(TGXFileRec_t *TGXFile);
+GDX_API int  GDX_CALLCONV C__gdxFooterIndex(TGXFileRec_t *TGXFile)
+{
+  return gdxFooterIndex(TGXFile);
+}
+
+GDX_API void GDX_CALLCONV C__gdxFooterIndexSet(TGXFileRec_t *TGXFile, int x);
+GDX_API void GDX_CALLCONV C__gdxFooterIndexSet(TGXFileRec_t *TGXFile, int x)
+{
+  gdxFooterIndexSet(TGXFile,x);
+}
+
+GDX_API int  GDX_CALLCONV C__gdxDataErrorLimit(TGXFileRec_t *TGXFile);
+GDX_API int  GDX_CALLCONV C__gdxDataErrorLimit(TGXFileRec_t *TGXFile)
+{
+  return gdxDataErrorLimit(TGXFile);
+}
+
+GDX_API void GDX_CALLCONV C__gdxDataErrorLimitSet(TGXFileRec_t *TGXFile, int x);
+GDX_API void GDX_CALLCONV C__gdxDataErrorLimitSet(TGXFileRec_t *TGXFile, int x)
+{
+  gdxDataErrorLimitSet(TGXFile,x);
+}
+
+GDX_API int  GDX_CALLCONV C__gdxStoreFingerprints(TGXFileRec_t *TGXFile);
+GDX_API int  GDX_CALLCONV C__gdxStoreFingerprints(TGXFileRec_t *TGXFile)
+{
+  return gdxStoreFingerprints(TGXFile);
+}
+
+GDX_API void GDX_CALLCONV C__gdxStoreFingerprintsSet(TGXFileRec_t *TGXFile, int x);
+GDX_API void GDX_CALLCONV C__gdxStoreFingerprintsSet(TGXFileRec_t *TGXFile, int x)
+{
+  gdxStoreFingerprintsSet(TGXFile,x);
+}
+
 #endif
 
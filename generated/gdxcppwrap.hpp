@@ -131,6 +131,36 @@ public:
      ::gdxMapAcronymsToNaNSet( pgx, flag );
    }
 
+   [[nodiscard]] int gdxFooterIndex() const
+   {
+     return ::gdxFooterIndex( pgx );
+   }
+
+   void gdxFooterIndexSet(int flag)
+   {
+     ::gdxFooterIndexSet( pgx, flag );
+   }
+
+   [[nodiscard]] int gdxDataErrorLimit() const
+   {
+     return ::gdxDataErrorLimit( pgx );
+   }
+
+   void gdxDataErrorLimitSet(int flag)
+   {
+     ::gdxDataErrorLimitSet( pgx, flag );
+   }
+
+   [[nodiscard]] int gdxStoreFingerprints() const
+   {
+     return ::gdxStoreFingerprints( pgx );
+   }
+
+   void gdxStoreFingerprintsSet(int flag)
+   {
+     ::gdxStoreFingerprintsSet( pgx, flag );
+   }
+
    int gdxAcronymAdd( const char *AName, const char *Txt, int AIndx )
    {
      return ::gdxAcronymAdd( pgx, AName, Txt, AIndx );
@@ -586,6 +616,46 @@ public:
      return ::gdxRenameUEL( pgx, OldName, NewName );
    }
 
+   int gdxDataReadRawStart64( int SyNr, int64_t &NrRecs )
+   {
+     return ::gdxDataReadRawStart64( pgx, SyNr, reinterpret_cast<INT64 *>( &NrRecs ) );
+   }
+
+   int gdxDataReadMapStart64( int SyNr, int64_t &NrRecs )
+   {
+     return ::gdxDataReadMapStart64( pgx, SyNr, reinterpret_cast<INT64 *>( &NrRecs ) );
+   }
+
+   int gdxDataReadStrStart64( int SyNr, int64_t &NrRecs )
+   {
+     return ::gdxDataReadStrStart64( pgx, SyNr, reinterpret_cast<INT64 *>( &NrRecs ) );
+   }
+
+   int gdxSymbolInfoX64( int SyNr, int64_t &RecCnt, int &UserInfo, char *ExplTxt )
+   {
+     return ::gdxSymbolInfoX64( pgx, SyNr, reinterpret_cast<INT64 *>( &RecCnt ), &UserInfo, ExplTxt );
+   }
+
+   int gdxDataErrorOverflowCount() const
+   {
+     return ::gdxDataErrorOverflowCount( pgx );
+   }
+
+   int gdxDataErrorRecords( int RecNr, int Cnt, int *KeyInt, double *Values )
+   {
+     return ::gdxDataErrorRecords( pgx, RecNr, Cnt, KeyInt, Values );
+   }
+
+   int gdxSymbolFingerprint( int SyNr, char *Fingerprint )
+   {
+     return ::gdxSymbolFingerprint( pgx, SyNr, Fingerprint );
+   }
+
+   int gdxSymbolDataBytes( int SyNr, int64_t Offset, int Count, void *Buffer )
+   {
+     return ::gdxSymbolDataBytes( pgx, SyNr, Offset, Count, Buffer );
+   }
+
    int gdxUELMaxLength()
    {
       return ::gdxUELMaxLength( pgx );
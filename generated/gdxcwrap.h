@@ -70,6 +70,9 @@ typedef signed long int INT64;
 #define GDX_INLINE inline
 #endif
 
+typedef void *( *TgdxAllocProc_t )( size_t Size, size_t Alignment, void *Uptr );
+typedef void ( *TgdxFreeProc_t )( void *P, size_t Size, void *Uptr );
+
 // PROTOTYPES BEGIN
 int gdxAcronymAdd( TGXFileRec_t *pgdx, const char *AName, const char *Txt, int AIndx );
 int gdxAcronymCount( TGXFileRec_t *pgdx);
@@ -162,6 +165,14 @@ int gdxUMUelInfo( TGXFileRec_t *pgdx, int *UelCnt, int *HighMap );
 int gdxGetDomainElements( TGXFileRec_t *pgdx, int SyNr, int DimPos, int FilterNr, TDomainIndexProc_t DP, int *NrElem, void *Uptr );
 int gdxCurrentDim( TGXFileRec_t *pgdx);
 int gdxRenameUEL( TGXFileRec_t *pgdx, const char *OldName, const char *NewName );
+int gdxDataReadRawStart64( TGXFileRec_t *pgdx, int SyNr, INT64 *NrRecs );
+int gdxDataReadMapStart64( TGXFileRec_t *pgdx, int SyNr, INT64 *NrRecs );
+int gdxDataReadStrStart64( TGXFileRec_t *pgdx, int SyNr, INT64 *NrRecs );
+int gdxSymbolInfoX64( TGXFileRec_t *pgdx, int SyNr, INT64 *RecCnt, int *UserInfo, char *ExplTxt );
+int gdxDataErrorOverflowCount( TGXFileRec_t *pgdx);
+int gdxDataErrorRecords( TGXFileRec_t *pgdx, int RecNr, int Cnt, int *KeyInt, double *Values );
+int gdxSymbolFingerprint( TGXFileRec_t *pgdx, int SyNr, char *Fingerprint );
+int gdxSymbolDataBytes( TGXFileRec_t *pgdx, int SyNr, INT64 Offset, int Count, void *Buffer );
 
 void GDX_CALLCONV doSetLoadPath( const char *s );
 void GDX_CALLCONV doGetLoadPath( char *s );
@@ -169,12 +180,19 @@ int gdxFree( TGXFileRec_t **pgdx );
 int gdxCreate( TGXFileRec_t **pgdx, char *errBuf, int bufSize );
 int gdxCreateD( TGXFileRec_t **pgdx, const char *sysDir, char *msgBuf, int msgBufLen );
 void gdxDestroy( TGXFileRec_t **pgx );
+int gdxSetAllocator( TgdxAllocProc_t AllocProc, TgdxFreeProc_t FreeProc, void *Uptr );
 int gdxStoreDomainSets( TGXFileRec_t *pgdx);
 void gdxStoreDomainSetsSet( TGXFileRec_t *pgdx, int flag);
 int gdxAllowBogusDomains( TGXFileRec_t *pgdx);
 void gdxAllowBogusDomainsSet( TGXFileRec_t *pgdx, int flag);
 int gdxMapAcronymsToNaN( TGXFileRec_t *pgdx);
 void gdxMapAcronymsToNaNSet( TGXFileRec_t *pgdx, int flag);
+int gdxFooterIndex( TGXFileRec_t *pgdx);
+void gdxFooterIndexSet( TGXFileRec_t *pgdx, int flag);
+int gdxDataErrorLimit( TGXFileRec_t *pgdx);
+void gdxDataErrorLimitSet( TGXFileRec_t *pgdx, int flag);
+int gdxStoreFingerprints( TGXFileRec_t *pgdx);
+void gdxStoreFingerprintsSet( TGXFileRec_t *pgdx, int flag);
 void setCallByRef( TGXFileRec_t *TGXFile, const char *FuncName, int cbrValue );
 // PROTOTYPES END
 
@@ -671,6 +689,46 @@ GDX_INLINE int gdxRenameUEL( TGXFileRec_t *pgx, const char *OldName, const char
    return reinterpret_cast<gdx::TGXFileObj *>( pgx )->gdxRenameUEL(OldName, NewName );
 }
 
+GDX_INLINE int gdxDataReadRawStart64( TGXFileRec_t *pgx, int SyNr, INT64 *NrRecs )
+{
+   return reinterpret_cast<gdx::TGXFileObj *>( pgx )->gdxDataReadRawStart64(SyNr, *reinterpret_cast<int64_t *>( NrRecs ) );
+}
+
+GDX_INLINE int gdxDataReadMapStart64( TGXFileRec_t *pgx, int SyNr, INT64 *NrRecs )
+{
+   return reinterpret_cast<gdx::TGXFileObj *>( pgx )->gdxDataReadMapStart64(SyNr, *reinterpret_cast<int64_t *>( NrRecs ) );
+}
+
+GDX_INLINE int gdxDataReadStrStart64( TGXFileRec_t *pgx, int SyNr, INT64 *NrRecs )
+{
+   return reinterpret_cast<gdx::TGXFileObj *>( pgx )->gdxDataReadStrStart64(SyNr, *reinterpret_cast<int64_t *>( NrRecs ) );
+}
+
+GDX_INLINE int gdxSymbolInfoX64( TGXFileRec_t *pgx, int SyNr, INT64 *RecCnt, int *UserInfo, char *ExplTxt )
+{
+   return reinterpret_cast<gdx::TGXFileObj *>( pgx )->gdxSymbolInfoX64(SyNr, *reinterpret_cast<int64_t *>( RecCnt ), *UserInfo, ExplTxt );
+}
+
+GDX_INLINE int gdxDataErrorOverflowCount( TGXFileRec_t *pgx)
+{
+   return reinterpret_cast<gdx::TGXFileObj *>( pgx )->gdxDataErrorOverflowCount();
+}
+
+GDX_INLINE int gdxDataErrorRecords( TGXFileRec_t *pgx, int RecNr, int Cnt, int *KeyInt, double *Values )
+{
+   return reinterpret_cast<gdx::TGXFileObj *>( pgx )->gdxDataErrorRecords(RecNr, Cnt, KeyInt, Values );
+}
+
+GDX_INLINE int gdxSymbolFingerprint( TGXFileRec_t *pgx, int SyNr, char *Fingerprint )
+{
+   return reinterpret_cast<gdx::TGXFileObj *>( pgx )->gdxSymbolFingerprint(SyNr, Fingerprint );
+}
+
+GDX_INLINE int gdxSymbolDataBytes( TGXFileRec_t *pgx, int SyNr, INT64 Offset, int Count, void *Buffer )
+{
+   return reinterpret_cast<gdx::TGXFileObj *>( pgx )->gdxSymbolDataBytes(SyNr, Offset, Count, Buffer );
+}
+
 
 GDX_INLINE int gdxStoreDomainSets( TGXFileRec_t *pgx)
 {
@@ -702,12 +760,47 @@ GDX_INLINE void gdxMapAcronymsToNaNSet( TGXFileRec_t *pgx, int flag)
    reinterpret_cast<gdx::TGXFileObj *>( pgx )->gdxMapAcronymsToNaNSet( flag );
 }
 
+GDX_INLINE int gdxFooterIndex( TGXFileRec_t *pgx)
+{
+   return reinterpret_cast<gdx::TGXFileObj *>( pgx )->gdxFooterIndex();
+}
+
+GDX_INLINE void gdxFooterIndexSet( TGXFileRec_t *pgx, int flag)
+{
+   reinterpret_cast<gdx::TGXFileObj *>( pgx )->gdxFooterIndexSet( flag );
+}
+
+GDX_INLINE int gdxDataErrorLimit( TGXFileRec_t *pgx)
+{
+   return reinterpret_cast<gdx::TGXFileObj *>( pgx )->gdxDataErrorLimit();
+}
+
+GDX_INLINE void gdxDataErrorLimitSet( TGXFileRec_t *pgx, int flag)
+{
+   reinterpret_cast<gdx::TGXFileObj *>( pgx )->gdxDataErrorLimitSet( flag );
+}
+
+GDX_INLINE int gdxStoreFingerprints( TGXFileRec_t *pgx)
+{
+   return reinterpret_cast<gdx::TGXFileObj *>( pgx )->gdxStoreFingerprints();
+}
+
+GDX_INLINE void gdxStoreFingerprintsSet( TGXFileRec_t *pgx, int flag)
+{
+   reinterpret_cast<gdx::TGXFileObj *>( pgx )->gdxStoreFingerprintsSet( flag );
+}
+
 GDX_INLINE int gdxFree( TGXFileRec_t **TGXFile )
 {
    gdxDestroy( TGXFile );
    return 1;
 }
 
+GDX_INLINE int gdxSetAllocator( TgdxAllocProc_t AllocProc, TgdxFreeProc_t FreeProc, void *Uptr )
+{
+   return gdx::gdxSetAllocator( AllocProc, FreeProc, Uptr );
+}
+
 GDX_INLINE int gdxCreateD( TGXFileRec_t **TGXFile, const char *sysDir, char *msgBuf, int msgBufLen )
 {
    doSetLoadPath( sysDir );
@@ -27,32 +27,38 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <cassert>
 
+#include "gmsalloc.hpp"
+
 namespace gdlib::batchalloc
 {
 
+// reset() rewinds to the first batch but keeps the batches, so an allocator that is
+// filled and emptied repeatedly (e.g. once per symbol) does not allocate again
 template<size_t batchSize, int byteAlign = 1>
 class BatchAllocator
 {
    struct DataBatch {
       DataBatch *next;
       uint8_t *ptr;
-   
-      explicit DataBatch( const size_t count ) : next {}, ptr { new uint8_t[count] }
+      size_t size;
+
+      explicit DataBatch( const size_t count ) : next {}, ptr { static_cast<uint8_t *>( gmsalloc::Allocate( count, byteAlign ) ) }, size { count }
       {
          assert(count % byteAlign == 0);
       }
    
       ~DataBatch()
       {
-         delete[] ptr;
+         gmsalloc::Free( ptr );
       }
    };
 
-   DataBatch *head {}, *tail {};
-   size_t offsetInTail {}, firstBatchSize {batchSize};
+   DataBatch *head {}, *tail {}, *cur {};// cur is the batch currently filled, batches after it are free
+   size_t offsetInCur {}, firstBatchSize {batchSize};
 public:
    BatchAllocator() = default;
 
@@ -61,6 +67,7 @@ public:
       clear();
    }
 
+   // free all batches
    void clear()
    {
       if( !head ) return;
@@ -70,7 +77,41 @@ public:
          next = it->next;
          delete it;
       }
-      head = tail = nullptr;
+      head = tail = cur = nullptr;
+      offsetInCur = 0;
+   }
+
+   // Make all memory available again without freeing the batches.
+   // Batches beyond the first keepBytes bytes are freed.
+   void reset( size_t keepBytes = SIZE_MAX )
+   {
+      if( !head ) return;
+      size_t kept { head->size };
+      DataBatch *last { head };
+      while( last->next && kept + last->next->size <= keepBytes )
+      {
+         last = last->next;
+         kept += last->size;
+      }
+      DataBatch *next;
+      for( const DataBatch *it = last->next; it; it = next )
+      {
+         next = it->next;
+         delete it;
+      }
+      last->next = nullptr;
+      tail = last;
+      cur = head;
+      offsetInCur = 0;
+   }
+
+   // total bytes of all batches, used or not
+   [[nodiscard]] size_t capacity() const
+   {
+      size_t res {};
+      for( const DataBatch *it = head; it; it = it->next )
+         res += it->size;
+      return res;
    }
 
    // Use different buffer size for first batch
@@ -78,7 +119,11 @@ public:
    void SetFirstBatchSize(size_t s) {
       if( const auto fbs = ( s + ( byteAlign - 1 ) ) & ~( byteAlign - 1 );
          fbs > batchSize && fbs < 0x10000000000)
+      {
+         // a kept first batch that is too small is of no use
+         if( head && cur == head && !offsetInCur && head->size < fbs ) clear();
          firstBatchSize = fbs;
+      }
    }
 
    uint8_t *GetBytes( size_t count )
@@ -89,17 +134,21 @@ public:
       assert( count <= batchSize );
       if( !head )
       {
-         head = tail = new DataBatch { firstBatchSize };
-         offsetInTail = 0;
+         head = tail = cur = new DataBatch { firstBatchSize };
+         offsetInCur = 0;
       }
-      else if( ( head == tail ? firstBatchSize : batchSize ) - offsetInTail < count )
+      else if( cur->size - offsetInCur < count )
       {
-         tail->next = new DataBatch { batchSize };
-         tail = tail->next;
-         offsetInTail = 0;
+         if( !cur->next )
+         {
+            tail->next = new DataBatch { batchSize };
+            tail = tail->next;
+         }
+         cur = cur->next;
+         offsetInCur = 0;
       }
-      const auto res { tail->ptr + offsetInTail };
-      offsetInTail += count;
+      const auto res { cur->ptr + offsetInCur };
+      offsetInCur += count;
       return res;
    }
 
@@ -74,8 +74,8 @@ class TLinkedData final
            FDimension {},// number of keys / symbol dimension
            FKeySize {},  // byte count for key storage
            FDataSize {}, // byte count for value storage
-           FTotalSize {},// byte count for entry
-           FCount {};
+           FTotalSize {};// byte count for entry
+   int64_t FCount {};
    using RecType = TLD_REC_TYPE;
    RecType *FHead {}, *FTail {};
 
@@ -83,6 +83,8 @@ class TLinkedData final
    gdlib::gmsheapnew::THeapMgr MyHeap { "TLinkedData" };
 #elif defined( TSH_BATCH_ALLOCS )
    batchalloc::BatchAllocator<960, 8> batchAllocator;
+   // Clear keeps up to this many bytes of batches for the next records
+   static constexpr size_t KeepBatchBytes { 16 * 1024 * 1024 };
 #endif
 
    bool IsSorted()
@@ -118,15 +120,25 @@ public:
       Clear();
    }
 
-   [[nodiscard]] int Count() const
+   [[nodiscard]] int64_t Count() const
    {
       return FCount;
    }
 
+   // Start over with another dimension and data size, reusing the memory of the records so far
+   void Reset( const int ADimension, const int ADataSize )
+   {
+      Clear();
+      FDimension = ADimension;
+      FKeySize = ADimension * static_cast<int>( sizeof( KeyType ) );
+      FDataSize = ADataSize;
+      FTotalSize = 1 * static_cast<int>( sizeof( void * ) ) + FKeySize + FDataSize;
+   }
+
    void Clear()
    {
 #if defined( TSH_BATCH_ALLOCS ) && !defined( USE_GMSHEAP )
-      batchAllocator.clear();
+      batchAllocator.reset( KeepBatchBytes );
 #else
       RecType *P { FHead };
       while( P )
@@ -145,7 +157,7 @@ public:
       FMinKey = std::numeric_limits<int>::max();
    }
 
-   [[nodiscard]] int MemoryUsed() const
+   [[nodiscard]] int64_t MemoryUsed() const
    {
       return FCount * FTotalSize;
    }
@@ -0,0 +1,115 @@
+/*
+ * GAMS - General Algebraic Modeling System GDX API
+ *
+ * Copyright (c) 2017-2026 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2026 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "gmsalloc.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <mutex>
+
+namespace gdlib::gmsalloc
+{
+
+// stored in front of every block
+struct TBlockHeader {
+   TFreeProc FreeProc;// nullptr: default allocator
+   void *Uptr;
+   size_t Size;  // as requested from the allocation procedure
+   size_t Offset;// from the start of the allocated memory to the user block
+   size_t Alignment;
+};
+
+struct TAllocHook {
+   TAllocProc AllocProc;
+   TFreeProc FreeProc;
+   void *Uptr;
+   const TAllocHook *Prev;// hook installed before, keeps all of them reachable
+};
+
+// Allocations only load the current hook (nullptr: default allocator). An installed hook is never freed,
+// since another thread may still be allocating through it (and static GDX objects may allocate during
+// shutdown). Installing a hook again reuses its record, so switching between hooks does not leak more
+// than one record per distinct hook; the mutex only serializes installing.
+static std::mutex HookMutex;
+static const TAllocHook *LastHook {};
+static std::atomic<const TAllocHook *> CurHook {};
+
+bool SetAllocator( TAllocProc AllocProc, TFreeProc FreeProc, void *Uptr )
+{
+   if( !AllocProc != !FreeProc ) return false;// both or none
+   std::lock_guard<std::mutex> lock { HookMutex };
+   const TAllocHook *Hook {};
+   if( AllocProc )
+   {
+      for( Hook = LastHook; Hook; Hook = Hook->Prev )
+         if( Hook->AllocProc == AllocProc && Hook->FreeProc == FreeProc && Hook->Uptr == Uptr ) break;
+      if( !Hook ) Hook = LastHook = new TAllocHook { AllocProc, FreeProc, Uptr, LastHook };
+   }
+   CurHook.store( Hook, std::memory_order_release );
+   return true;
+}
+
+void GetAllocator( TAllocProc &AllocProc, TFreeProc &FreeProc, void *&Uptr )
+{
+   const TAllocHook *Hook { CurHook.load( std::memory_order_acquire ) };
+   AllocProc = Hook ? Hook->AllocProc : nullptr;
+   FreeProc = Hook ? Hook->FreeProc : nullptr;
+   Uptr = Hook ? Hook->Uptr : nullptr;
+}
+
+void *Allocate( const size_t Size, size_t Alignment )
+{
+   if( Alignment < alignof( TBlockHeader ) ) Alignment = alignof( TBlockHeader );
+   assert( !( Alignment & ( Alignment - 1 ) ) );
+   // header rounded up to the alignment, so the user block stays aligned
+   const size_t Offset { ( sizeof( TBlockHeader ) + Alignment - 1 ) & ~( Alignment - 1 ) };
+   if( Size > std::numeric_limits<size_t>::max() - Offset ) throw std::bad_alloc {};
+   const size_t Total { Size + Offset };
+
+   TAllocProc AllocProc;
+   TFreeProc FreeProc;
+   void *Uptr;
+   GetAllocator( AllocProc, FreeProc, Uptr );
+   void *Mem { AllocProc ? AllocProc( Total, Alignment, Uptr ) : ::operator new( Total, std::align_val_t { Alignment }, std::nothrow ) };
+   if( !Mem ) throw std::bad_alloc {};
+   auto *Block { static_cast<uint8_t *>( Mem ) + Offset };
+   const TBlockHeader Header { AllocProc ? FreeProc : nullptr, Uptr, Total, Offset, Alignment };
+   std::memcpy( Block - sizeof( TBlockHeader ), &Header, sizeof( TBlockHeader ) );
+   return Block;
+}
+
+void Free( void *P )
+{
+   if( !P ) return;
+   TBlockHeader Header;
+   std::memcpy( &Header, static_cast<uint8_t *>( P ) - sizeof( TBlockHeader ), sizeof( TBlockHeader ) );
+   void *Mem { static_cast<uint8_t *>( P ) - Header.Offset };
+   if( Header.FreeProc ) Header.FreeProc( Mem, Header.Size, Header.Uptr );
+   else
+      ::operator delete( Mem, std::align_val_t { Header.Alignment } );
+}
+
+}// namespace gdlib::gmsalloc
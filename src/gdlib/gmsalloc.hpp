@@ -0,0 +1,97 @@
+/*
+ * GAMS - General Algebraic Modeling System GDX API
+ *
+ * Copyright (c) 2017-2026 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2026 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <vector>
+
+// Allocation hook for the memory of the main GDX containers (batch allocators for records and strings,
+// hash tables, integer mappings, bit arrays, record tables and stream buffers).
+// By default the memory comes from operator new. An application can install its own procedures,
+// e.g. for NUMA local or huge page backed memory or to account the memory of each tenant.
+// Every block remembers the procedures it was allocated with, so the hook can be changed at any time
+// and each block is still handed back to the procedure that allocated it.
+
+namespace gdlib::gmsalloc
+{
+
+// returns nullptr when out of memory, Alignment is a power of two
+using TAllocProc = void *( * ) ( size_t Size, size_t Alignment, void *Uptr );
+// Size is the size that was requested from the matching TAllocProc call
+using TFreeProc = void ( * )( void *P, size_t Size, void *Uptr );
+
+// Install AllocProc/FreeProc for all following allocations of the whole process (all GDX objects in all
+// threads, not a single file object), passing nullptr for both restores the default.
+// Allocating does not lock, only installing does
+bool SetAllocator( TAllocProc AllocProc, TFreeProc FreeProc, void *Uptr );
+void GetAllocator( TAllocProc &AllocProc, TFreeProc &FreeProc, void *&Uptr );
+
+// throws std::bad_alloc when the allocation fails
+void *Allocate( size_t Size, size_t Alignment = alignof( std::max_align_t ) );
+void Free( void *P );
+
+// for std containers
+template<typename T>
+struct TAllocator {
+   using value_type = T;
+
+   TAllocator() = default;
+
+   template<typename U>
+   TAllocator( const TAllocator<U> & ) noexcept
+   {}
+
+   T *allocate( const size_t n )
+   {
+      if( n > std::numeric_limits<size_t>::max() / sizeof( T ) ) throw std::bad_alloc {};
+      return static_cast<T *>( Allocate( n * sizeof( T ), alignof( T ) ) );
+   }
+
+   void deallocate( T *p, size_t ) noexcept
+   {
+      Free( p );
+   }
+
+   template<typename U>
+   bool operator==( const TAllocator<U> & ) const noexcept
+   {
+      return true;
+   }
+
+   template<typename U>
+   bool operator!=( const TAllocator<U> & ) const noexcept
+   {
+      return false;
+   }
+};
+
+template<typename T>
+using TVector = std::vector<T, TAllocator<T>>;
+
+}// namespace gdlib::gmsalloc
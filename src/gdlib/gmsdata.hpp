@@ -30,96 +30,148 @@
 #include <string>
 #include <array>
 #include <vector>
+#include <algorithm>
+#include <numeric>
+#include <cassert>
+#include <cstring>
 
 #include "gmsobj.hpp"
+#include "gmsalloc.hpp"
 
 namespace gdlib::gmsdata
 {
+// Records are stored back to back in chunks of RecsPerChunk records, each record holding FDim keys followed
+// by FDataSize bytes of values (aligned for T). The first chunk grows on demand, so small tables stay small.
+// Sort sorts a permutation of the record numbers and then moves the records into place one cycle at a time.
 template<typename T>
 class TTblGamsData final
 {
-   int FDim, FDataSize;
-   std::vector<std::pair<int *, T *>> keyValues {};
+   static constexpr int ChunkBits { 14 }, RecsPerChunk { 1 << ChunkBits };
+   int FDim, FDataSize, FKeyBytes, FRecSize;
+   int64_t FCount {};
+   std::vector<gmsalloc::TVector<uint8_t>> Chunks {};
 
-public:
-   TTblGamsData( const int ADim, const int ADataSize ) : FDim { ADim }, FDataSize { ADataSize } {}
+   [[nodiscard]] uint8_t *RecPtr( const int64_t N )
+   {
+      return Chunks[N >> ChunkBits].data() + ( N & ( RecsPerChunk - 1 ) ) * FRecSize;
+   }
 
-   ~TTblGamsData()
+   [[nodiscard]] const int *KeyPtr( const int64_t N ) const
    {
-      Clear();
+      return reinterpret_cast<const int *>( Chunks[N >> ChunkBits].data() + ( N & ( RecsPerChunk - 1 ) ) * FRecSize );
    }
 
-   void GetRecord( int N, int *Inx, T *Vals )
+   [[nodiscard]] bool KeysLess( const int64_t N1, const int64_t N2 ) const
    {
-      std::memcpy( Inx, keyValues[N].first, FDim * sizeof( int ) );
-      std::memcpy( Vals, keyValues[N].second, FDataSize );
+      const int *k1 { KeyPtr( N1 ) }, *k2 { KeyPtr( N2 ) };
+      return std::lexicographical_compare( k1, k1 + FDim, k2, k2 + FDim );
    }
 
-   void GetKeys( int N, int *Inx )
+public:
+   TTblGamsData( const int ADim, const int ADataSize ) : FDim { ADim }, FDataSize { ADataSize },
+                                                        FKeyBytes { static_cast<int>( ( ADim * sizeof( int ) + alignof( T ) - 1 ) / alignof( T ) * alignof( T ) ) },
+                                                        FRecSize { static_cast<int>( ( FKeyBytes + ADataSize + alignof( T ) - 1 ) / alignof( T ) * alignof( T ) ) }
+   {}
+
+   void GetRecord( int64_t N, int *Inx, T *Vals )
    {
-      std::memcpy( Inx, keyValues[N].first, FDim * sizeof( int ) );
+      const uint8_t *rec { RecPtr( N ) };
+      std::memcpy( Inx, rec, FDim * sizeof( int ) );
+      std::memcpy( Vals, rec + FKeyBytes, FDataSize );
    }
 
-   void GetData( int N, T *Vals )
+   void GetKeys( int64_t N, int *Inx )
    {
-      std::memcpy( Vals, keyValues[N].second, FDataSize );
+      std::memcpy( Inx, RecPtr( N ), FDim * sizeof( int ) );
    }
 
-   double *GetDataPtr( int N )
+   void GetData( int64_t N, T *Vals )
    {
-      return keyValues[N].second;
+      std::memcpy( Vals, RecPtr( N ) + FKeyBytes, FDataSize );
    }
 
-   void AddRecord( const int *AElements, const T *AVals )
+   T *GetDataPtr( int64_t N )
    {
-      // NOTE: Maybe use batch allocator vs. single new allocs here for performance?
-      auto vals { new T[static_cast<size_t>( FDataSize ) / sizeof( T )] };
-      std::memcpy( vals, AVals, FDataSize );
-      auto keys { new int[FDim] };
-      std::memcpy( keys, AElements, FDim * sizeof( int ) );
-      keyValues.emplace_back( keys, vals );
+      return reinterpret_cast<T *>( RecPtr( N ) + FKeyBytes );
    }
 
-   void Clear()
+   void AddRecord( const int *AElements, const T *AVals )
    {
-      for( auto [k, v]: keyValues )
+      const auto chunkNr { static_cast<size_t>( FCount >> ChunkBits ) };
+      if( chunkNr == Chunks.size() )
       {
-         delete[] k;
-         delete[] v;
+         Chunks.emplace_back();
+         // only the first chunk grows step by step, later ones are allocated at full size
+         if( chunkNr > 0 ) Chunks.back().reserve( static_cast<size_t>( RecsPerChunk ) * FRecSize );
       }
-      keyValues.clear();
+      auto &chunk { Chunks[chunkNr] };
+      chunk.resize( chunk.size() + FRecSize );
+      uint8_t *rec { chunk.data() + chunk.size() - FRecSize };
+      std::memcpy( rec, AElements, FDim * sizeof( int ) );
+      std::memcpy( rec + FKeyBytes, AVals, FDataSize );
+      FCount++;
+   }
+
+   void Clear()
+   {
+      Chunks.clear();
+      FCount = 0;
    }
 
-   [[nodiscard]] int size() const
+   [[nodiscard]] int64_t size() const
    {
-      return static_cast<int>( keyValues.size() );
+      return FCount;
    }
 
-   [[nodiscard]] int GetCount() const
+   [[nodiscard]] int64_t GetCount() const
    {
       return size();
    }
 
    [[nodiscard]] bool empty() const
    {
-      return keyValues.empty();
+      return !FCount;
    }
 
    void Sort()
    {
-      std::sort( keyValues.begin(), keyValues.end(), [this]( const auto &pair1, const auto &pair2 ) {
-         for( int i {}; i < FDim; i++ )
+      // records from a GDX file usually arrive in order already
+      int64_t N { 1 };
+      while( N < FCount && !KeysLess( N, N - 1 ) ) N++;
+      if( N >= FCount ) return;
+
+      // Perm[N] is the record that belongs at position N
+      std::vector<int64_t> Perm( FCount );
+      std::iota( Perm.begin(), Perm.end(), 0 );
+      std::sort( Perm.begin(), Perm.end(), [this]( const int64_t N1, const int64_t N2 ) { return KeysLess( N1, N2 ); } );
+
+      std::vector<uint8_t> Tmp( FRecSize );
+      for( int64_t Start {}; Start < FCount; Start++ )
+      {
+         if( Perm[Start] == Start ) continue;
+         std::memcpy( Tmp.data(), RecPtr( Start ), FRecSize );
+         int64_t Dst { Start };
+         while( true )
          {
-            if( pair1.first[i] < pair2.first[i] ) return true;
-            if( pair1.first[i] > pair2.first[i] ) break;
+            const int64_t Src { Perm[Dst] };
+            Perm[Dst] = Dst;
+            if( Src == Start )
+            {
+               std::memcpy( RecPtr( Dst ), Tmp.data(), FRecSize );
+               break;
+            }
+            std::memcpy( RecPtr( Dst ), RecPtr( Src ), FRecSize );
+            Dst = Src;
          }
-         return false;
-      } );
+      }
    }
 
-   [[nodiscard]] int MemoryUsed() const
+   [[nodiscard]] int64_t MemoryUsed() const
    {
-      return static_cast<int>( keyValues.size() * ( FDim * sizeof( int ) + FDataSize * sizeof( T ) ) + keyValues.capacity() );
+      int64_t res { static_cast<int64_t>( Chunks.capacity() * sizeof( gmsalloc::TVector<uint8_t> ) ) };
+      for( const auto &chunk: Chunks )
+         res += static_cast<int64_t>( chunk.capacity() );
+      return res;
    }
 
    [[nodiscard]] int GetDimension() const
@@ -129,30 +181,44 @@ public:
 };
 
 constexpr int BufSize = 1024 * 16;
+// upper bound for the chunk size, the size of a huge page on x86-64
+constexpr int MaxBufSize = 1024 * 1024 * 2;
 
-struct TGADataBuffer {
-   // filler is needed, so a buffer can start on 8 byte boundary
-   int BytesUsed {}, filler {};
-   std::array<uint8_t, BufSize> Buffer {};
-};
-
+// Fixed size items stored in chunks of ChunkBytes (default BufSize, at most MaxBufSize) obtained from gmsalloc,
+// so the chunks can be backed by huge pages through an installed allocator. Items never move once added.
 template<typename T>
 class TGrowArrayFxd
 {
-   TGADataBuffer **PBase {};// dynamic heap array of pointers
-   TGADataBuffer *PCurrentBuf {};
-   int BaseAllocated {}, BaseUsed { -1 }, FSize, FStoreFact;
+   gmsalloc::TVector<uint8_t *> Chunks;// directory of chunks
+   uint8_t *PCurrentBuf {};
+   int FSize, FChunkBytes, BytesUsed {};// BytesUsed: in the current (last) chunk
+   int64_t FStoreFact;                 // items per chunk
+
+   void NewChunk()
+   {
+      PCurrentBuf = static_cast<uint8_t *>( gmsalloc::Allocate( FChunkBytes, std::max<size_t>( alignof( T ), 8 ) ) );
+      Chunks.push_back( PCurrentBuf );
+      BytesUsed = 0;
+   }
 
 protected:
    int64_t FCount {};
 
 public:
-   explicit TGrowArrayFxd() : FSize { sizeof( T ) },
-                              FStoreFact { BufSize / FSize }
+   explicit TGrowArrayFxd() : TGrowArrayFxd( sizeof( T ) )
    {}
 
-   explicit TGrowArrayFxd( const int ASize ) : FSize { ASize }, FStoreFact { BufSize / FSize }
-   {}
+   explicit TGrowArrayFxd( const int ASize, const int AChunkBytes = BufSize )
+       : FSize { ASize },
+         FChunkBytes { std::max( ASize, std::min( AChunkBytes, MaxBufSize ) ) },
+         FStoreFact { FChunkBytes / FSize }
+   {
+      // only use whole items
+      FChunkBytes = static_cast<int>( FStoreFact * FSize );
+   }
+
+   TGrowArrayFxd( const TGrowArrayFxd & ) = delete;
+   TGrowArrayFxd &operator=( const TGrowArrayFxd & ) = delete;
 
    virtual ~TGrowArrayFxd()
    {
@@ -161,47 +227,27 @@ public:
 
    void Clear()
    {
-      while( BaseUsed >= 0 )
-      {
-         delete PBase[BaseUsed];
-         BaseUsed--;
-      }
-      std::free( PBase );
-      PBase = nullptr;
-      BaseAllocated = 0;
+      for( uint8_t *P: Chunks )
+         gmsalloc::Free( P );
+      Chunks.clear();
+      Chunks.shrink_to_fit();
       PCurrentBuf = nullptr;
+      BytesUsed = 0;
       FCount = 0;
    }
 
+   // make room in the chunk directory for Cnt items in total
+   void Reserve( const int64_t Cnt )
+   {
+      Chunks.reserve( static_cast<size_t>( ( Cnt + FStoreFact - 1 ) / FStoreFact ) );
+   }
+
    T *ReserveMem()
    {
-      if( !PCurrentBuf || PCurrentBuf->BytesUsed + FSize > BufSize )
-      {
-         BaseUsed++;
-         if( BaseUsed >= BaseAllocated )
-         {
-            if( !BaseAllocated ) BaseAllocated = 32;
-            else
-               BaseAllocated *= 2;
-            const size_t newByteCount { BaseAllocated * sizeof( uint8_t * ) };
-            if( !PBase ) PBase = static_cast<TGADataBuffer **>( std::malloc( newByteCount ) );
-            else
-            {
-               const auto PBaseRA = static_cast<TGADataBuffer **>( std::realloc( PBase, newByteCount ) );
-               if( !PBaseRA && PBase )
-                  std::free( PBase );
-               PBase = PBaseRA;
-            }
-            assert( PBase );
-         }
-         PCurrentBuf = new TGADataBuffer;
-         assert( BaseUsed >= 0 );
-         if( BaseUsed >= 0 )
-            PBase[BaseUsed] = PCurrentBuf;
-         PCurrentBuf->BytesUsed = 0;
-      }
-      const auto res = reinterpret_cast<T *>( &PCurrentBuf->Buffer[PCurrentBuf->BytesUsed] );
-      PCurrentBuf->BytesUsed += FSize;
+      if( !PCurrentBuf || BytesUsed + FSize > FChunkBytes )
+         NewChunk();
+      const auto res = reinterpret_cast<T *>( PCurrentBuf + BytesUsed );
+      BytesUsed += FSize;
       FCount++;
       return res;
    }
@@ -220,17 +266,54 @@ public:
       return res;
    }
 
-   T *GetItemPtrIndex( const int N )
+   // append Cnt items stored back to back at R, one memcpy per chunk touched, returns the index of the first
+   int64_t AddItems( const T *R, int64_t Cnt )
    {
-      return reinterpret_cast<T *>( &PBase[N / FStoreFact]->Buffer[( N % FStoreFact ) * FSize] );
+      const int64_t res { FCount };
+      Reserve( FCount + Cnt );
+      auto *Src { reinterpret_cast<const uint8_t *>( R ) };
+      while( Cnt > 0 )
+      {
+         if( !PCurrentBuf || BytesUsed + FSize > FChunkBytes )
+            NewChunk();
+         const int64_t n { std::min<int64_t>( Cnt, ( FChunkBytes - BytesUsed ) / FSize ) };
+         const size_t Bytes { static_cast<size_t>( n * FSize ) };
+         std::memcpy( PCurrentBuf + BytesUsed, Src, Bytes );
+         Src += Bytes;
+         BytesUsed += static_cast<int>( Bytes );
+         FCount += n;
+         Cnt -= n;
+      }
+      return res;
    }
 
-   [[nodiscard]] T *GetItemPtrIndexConst( const int N ) const
+   // copy Cnt items starting with item First to Dest (back to back)
+   void CopyItems( int64_t First, int64_t Cnt, T *Dest ) const
    {
-      return reinterpret_cast<T *>( &PBase[N / FStoreFact]->Buffer[( N % FStoreFact ) * FSize] );
+      assert( First >= 0 && First + Cnt <= FCount );
+      auto *Dst { reinterpret_cast<uint8_t *>( Dest ) };
+      while( Cnt > 0 )
+      {
+         const int64_t Offs { First % FStoreFact }, n { std::min( Cnt, FStoreFact - Offs ) };
+         const size_t Bytes { static_cast<size_t>( n * FSize ) };
+         std::memcpy( Dst, Chunks[static_cast<size_t>( First / FStoreFact )] + Offs * FSize, Bytes );
+         Dst += Bytes;
+         First += n;
+         Cnt -= n;
+      }
    }
 
-   void GetItem( int N, T **R )
+   T *GetItemPtrIndex( const int64_t N )
+   {
+      return reinterpret_cast<T *>( Chunks[static_cast<size_t>( N / FStoreFact )] + ( N % FStoreFact ) * FSize );
+   }
+
+   [[nodiscard]] T *GetItemPtrIndexConst( const int64_t N ) const
+   {
+      return reinterpret_cast<T *>( Chunks[static_cast<size_t>( N / FStoreFact )] + ( N % FStoreFact ) * FSize );
+   }
+
+   void GetItem( int64_t N, T **R )
    {
       const auto PB { GetItemPtrIndex( N ) };
       std::memcpy( R, PB, FSize );
@@ -238,7 +321,12 @@ public:
 
    [[nodiscard]] int64_t MemoryUsed() const
    {
-      return !PCurrentBuf ? 0 : static_cast<int64_t>( BaseAllocated * sizeof( uint8_t * ) + BaseUsed * BufSize + PCurrentBuf->BytesUsed );
+      return !PCurrentBuf ? 0 : static_cast<int64_t>( Chunks.capacity() * sizeof( uint8_t * ) ) + static_cast<int64_t>( Chunks.size() - 1 ) * FChunkBytes + BytesUsed;
+   }
+
+   [[nodiscard]] int GetChunkBytes() const
+   {
+      return FChunkBytes;
    }
 
    [[nodiscard]] int64_t GetCount() const
@@ -251,7 +339,7 @@ public:
       return FCount;
    }
 
-   T *operator[]( const int N ) const
+   T *operator[]( const int64_t N ) const
    {
       return GetItemPtrIndexConst( N );
    }
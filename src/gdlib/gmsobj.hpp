@@ -29,8 +29,14 @@
 #include <cstdint>
 #include <cassert>
 #include <limits>
+#include <vector>
+#include <algorithm>
+#if defined( _MSC_VER )
+#include <intrin.h>
+#endif
 #include "utils.hpp"
 #include "strutilx.hpp"
+#include "gmsalloc.hpp"
 
 // ==============================================================================================================
 // Interface
@@ -315,63 +321,91 @@ public:
    }
 };
 
+inline int PopCount64( const uint64_t w )
+{
+#if defined( _MSC_VER ) && defined( _M_X64 )
+   return static_cast<int>( __popcnt64( w ) );
+#elif defined( __GNUC__ )
+   return __builtin_popcountll( w );
+#else
+   uint64_t x { w - ( ( w >> 1 ) & 0x5555555555555555ull ) };
+   x = ( x & 0x3333333333333333ull ) + ( ( x >> 2 ) & 0x3333333333333333ull );
+   x = ( x + ( x >> 4 ) ) & 0x0F0F0F0F0F0F0F0Full;
+   return static_cast<int>( ( x * 0x0101010101010101ull ) >> 56 );
+#endif
+}
+
+// w must not be zero
+inline int CountTrailingZeros64( const uint64_t w )
+{
+   assert( w );
+#if defined( _MSC_VER ) && defined( _M_X64 )
+   unsigned long res;
+   _BitScanForward64( &res, w );
+   return static_cast<int>( res );
+#elif defined( __GNUC__ )
+   return __builtin_ctzll( w );
+#else
+   return PopCount64( ( w & ( ~w + 1 ) ) - 1 );
+#endif
+}
+
+// Bits are stored in 64 bit words. Bits above the high index are always zero,
+// so counting and the bulk operations can work on whole words.
+// Rank and Select use a table of cumulative counts per block of RankBlockWords words,
+// which is built on first use and dropped by any change of the bits.
 class TBooleanBitArray
 {
-   uint8_t *PData;
-   int FAllocated, FHighIndex;
+   static constexpr int RankBlockWords { 8 };
+   gmsalloc::TVector<uint64_t> Words;
+   mutable gmsalloc::TVector<int> RankBlocks;// set bits before each block, empty when outdated
+   int FHighIndex;
 
-   static void GetBitMask( int V, int &N, uint8_t &M )
+   static int WordCount( int HighIndex )
    {
-      N = V >> 3;
-      M = 1 << ( V & 0x7 );
+      return HighIndex < 0 ? 0 : ( HighIndex >> 6 ) + 1;
    }
 
-public:
-   TBooleanBitArray() : PData {}, FAllocated {}, FHighIndex { -1 }
+   void BuildRankBlocks() const
    {
+      RankBlocks.resize( ( Words.size() + RankBlockWords - 1 ) / RankBlockWords + 1 );
+      int Cnt {};
+      for( size_t W {}; W < Words.size(); W++ )
+      {
+         if( W % RankBlockWords == 0 ) RankBlocks[W / RankBlockWords] = Cnt;
+         Cnt += PopCount64( Words[W] );
+      }
+      RankBlocks.back() = Cnt;
    }
 
-   ~TBooleanBitArray()
+public:
+   TBooleanBitArray() : FHighIndex { -1 }
    {
-      if( FAllocated > 0 )
-         delete[] PData;
    }
 
    [[nodiscard]] bool GetBit( int N ) const
    {
       if( N < 0 || N > FHighIndex ) return false;
-      int P;
-      uint8_t M;
-      GetBitMask( N, P, M );
-      return PData[P] & M;
+      return Words[N >> 6] >> ( N & 63 ) & 1;
    }
 
    void SetHighIndex( int V )
    {
       if( V > FHighIndex )
       {
-         if( int NewMemSize { ( V + 8 ) / 8 }; NewMemSize > FAllocated )
+         if( const size_t NewWords = WordCount( V ); NewWords > Words.size() )
          {
-            int Delta {};
-            do {
-               if( !FAllocated ) Delta += 256;
-               else if( FAllocated < 32 * 256 )
-                  Delta += FAllocated;
-               else
-                  Delta += FAllocated / 4;
-            } while( NewMemSize >= FAllocated + Delta );
-            NewMemSize = FAllocated + Delta;
-            const auto NewMem = new uint8_t[NewMemSize];
-            memset( NewMem, 0, NewMemSize );
-            if( FAllocated )
+            if( NewWords > Words.capacity() )
             {
-               std::memcpy( NewMem, PData, FAllocated );
-               delete[] PData;
+               size_t NewCap { Words.capacity() ? Words.capacity() : 32 };
+               while( NewCap < NewWords )
+                  NewCap += NewCap < 1024 ? NewCap : NewCap / 4;
+               Words.reserve( NewCap );
             }
-            PData = NewMem;
-            FAllocated = NewMemSize;
+            Words.resize( NewWords, 0 );
          }
          FHighIndex = V;
+         RankBlocks.clear();
       }
    }
 
@@ -389,18 +423,91 @@ public:
             if( !V ) return;
             SetHighIndex( N );
          }
-         int P;
-         uint8_t M;
-         GetBitMask( N, P, M );
-         if( V ) PData[P] |= M;
+         const uint64_t M { uint64_t { 1 } << ( N & 63 ) };
+         if( V ) Words[N >> 6] |= M;
+         else
+            Words[N >> 6] &= ~M;
+         RankBlocks.clear();
+      }
+   }
+
+   // number of bits set
+   [[nodiscard]] int Count() const
+   {
+      if( !RankBlocks.empty() ) return RankBlocks.back();
+      int res {};
+      for( const uint64_t W: Words )
+         res += PopCount64( W );
+      return res;
+   }
+
+   // number of bits set below N
+   [[nodiscard]] int Rank( int N ) const
+   {
+      if( N <= 0 ) return 0;
+      if( N > FHighIndex ) return Count();
+      if( RankBlocks.empty() ) BuildRankBlocks();
+      const int W { N >> 6 };
+      int res { RankBlocks[W / RankBlockWords] };
+      for( int W2 { W - W % RankBlockWords }; W2 < W; W2++ )
+         res += PopCount64( Words[W2] );
+      if( N & 63 ) res += PopCount64( Words[W] & ( ( uint64_t { 1 } << ( N & 63 ) ) - 1 ) );
+      return res;
+   }
+
+   // index of the K-th bit set (zero based) or -1 when fewer bits are set
+   [[nodiscard]] int Select( int K ) const
+   {
+      if( K < 0 ) return -1;
+      if( RankBlocks.empty() ) BuildRankBlocks();
+      if( K >= RankBlocks.back() ) return -1;
+      // last block starting with at most K bits set before it
+      const auto Blk { std::upper_bound( RankBlocks.begin(), RankBlocks.end() - 1, K ) - RankBlocks.begin() - 1 };
+      K -= RankBlocks[Blk];
+      for( size_t W { static_cast<size_t>( Blk ) * RankBlockWords };; W++ )
+      {
+         uint64_t Bits { Words[W] };
+         if( const int Cnt { PopCount64( Bits ) }; K >= Cnt ) K -= Cnt;
          else
-            PData[P] &= !M;
+         {
+            for( ; K > 0; K-- )
+               Bits &= Bits - 1;
+            return static_cast<int>( W * 64 ) + CountTrailingZeros64( Bits );
+         }
       }
    }
 
+   // this := this and Other
+   void AndWith( const TBooleanBitArray &Other )
+   {
+      const size_t Common { std::min( Words.size(), Other.Words.size() ) };
+      for( size_t W {}; W < Common; W++ )
+         Words[W] &= Other.Words[W];
+      std::fill( Words.begin() + static_cast<std::ptrdiff_t>( Common ), Words.end(), 0 );
+      RankBlocks.clear();
+   }
+
+   // this := this or Other
+   void OrWith( const TBooleanBitArray &Other )
+   {
+      SetHighIndex( Other.FHighIndex );
+      for( size_t W {}; W < Other.Words.size(); W++ )
+         Words[W] |= Other.Words[W];
+      RankBlocks.clear();
+   }
+
+   // this := this and not Other
+   void AndNotWith( const TBooleanBitArray &Other )
+   {
+      const size_t Common { std::min( Words.size(), Other.Words.size() ) };
+      for( size_t W {}; W < Common; W++ )
+         Words[W] &= ~Other.Words[W];
+      RankBlocks.clear();
+   }
+
    [[nodiscard]] int MemoryUsed() const
    {
-      return FAllocated;
+      return static_cast<int>( ( Words.capacity() * sizeof( uint64_t ) + RankBlocks.capacity() * sizeof( int ) ) );
    }
 };
 
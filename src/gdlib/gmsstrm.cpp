@@ -485,13 +485,9 @@ std::string TXFileStream::RandString( int L )
 
 int64_t TXFileStream::GetSize()
 {
-#ifdef __IN_CPPMEX__
-   int64_t res;
+   int64_t res {};
    SetLastIOResult( p3FileGetSize( FS, res ) );
    return res;
-#else
-   return 0;
-#endif
 }
 
 int64_t TXFileStream::GetPosition()
@@ -663,7 +659,7 @@ TBufferedFileStream::TBufferedFileStream( const std::string &FileName, uint16_t
       BufSize { BufferSize },
       CBufSize {  utils::round<uint32_t>( static_cast<double>( BufferSize ) * 12.0 / 10.0 ) + 20 },
       BufPtr( BufferSize ),
-      CBufPtr { static_cast<PCompressBuffer>( malloc( sizeof( TCompressHeader ) + CBufSize ) ) },
+      CBufPtr { static_cast<PCompressBuffer>( gmsalloc::Allocate( sizeof( TCompressHeader ) + CBufSize ) ) },
       FCompress {},
       FCanCompress { true }// no longer a fatal error
 {
@@ -673,7 +669,7 @@ TBufferedFileStream::~TBufferedFileStream()
 {
    if( NrWritten > 0 )
       FlushBuffer();
-   free( CBufPtr );
+   gmsalloc::Free( CBufPtr );
 }
 
 bool TBufferedFileStream::FlushBuffer()
@@ -34,6 +34,7 @@
 #include <string_view>          // for string_view
 #include <vector>               // for vector
 #include "../rtl/p3utils.hpp"     // for Tp3FileHandle
+#include "gmsalloc.hpp"           // for TVector, Allocate, Free
 
 #if defined( NO_ZLIB )
 inline int uncompress( void *dest, unsigned long *destLen, const void *source, unsigned long sourceLen )
@@ -244,16 +245,13 @@ class TBufferedFileStream : public TXFileStream
 
    uint32_t NrLoaded, NrRead, NrWritten, BufSize, CBufSize;
 
-   std::vector<uint8_t> BufPtr;
+   gmsalloc::TVector<uint8_t> BufPtr;
    PCompressBuffer CBufPtr;
 
    bool FCompress, FCanCompress;
 
    bool FillBuffer();
 
-protected:
-   int64_t GetSize() override;
-
 public:
    TBufferedFileStream( const std::string &FileName, uint16_t Mode );
    ~TBufferedFileStream() override;
@@ -269,6 +267,8 @@ public:
    int64_t GetPosition() override;
 
    void SetPosition( int64_t p ) override;
+
+   int64_t GetSize() override;
 };
 
 void reverseBytesMax8( const void *psrc, void *pdest, int sz );
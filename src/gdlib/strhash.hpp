@@ -31,18 +31,83 @@
 #include "utils.hpp"
 #include "datastorage.hpp"
 #include "gmsdata.hpp"
+#include "gmsalloc.hpp"
 
 #include <vector>
 #include <string>
 #include <cassert>
+#include <cstdint>
+#include <cstring>
 #include <numeric>
 
 namespace gdlib::strhash
 {
+// Upper cases all ASCII letters in the 8 bytes of w at once (bytes >= 128 are left alone like utils::toupper)
+inline uint64_t UpperCase8( const uint64_t w )
+{
+   constexpr uint64_t Ones { 0x0101010101010101ull }, High { Ones * 0x80 };
+   const uint64_t heptets { w & ~High };
+   const uint64_t geA { heptets + Ones * ( 0x80 - 'a' ) }, gtZ { heptets + Ones * ( 0x80 - 'z' - 1 ) };
+   return w ^ ( ( geA & ~gtZ & ~w & High ) >> 2 );
+}
+
+inline uint64_t RotL64( const uint64_t x, const int r )
+{
+   return x << r | x >> ( 64 - r );
+}
+
+// Final avalanche step of MurmurHash3
+inline uint64_t Mix64( uint64_t h )
+{
+   h ^= h >> 33;
+   h *= 0xFF51AFD7ED558CCDull;
+   h ^= h >> 33;
+   h *= 0xC4CEB9FE1A85EC53ull;
+   h ^= h >> 33;
+   return h;
+}
+
+// 64 bit hash of the first slen characters of s, 16 bytes per step in two independent lanes.
+// With CaseInsensitive the letters are folded to upper case word by word, so HashText<true>
+// gives the same value for strings that are equal according to utils::sameTextPChar.
+template<bool CaseInsensitive = true>
+inline uint64_t HashText( const char *s, const size_t slen )
+{
+   constexpr uint64_t K1 { 0x9E3779B97F4A7C15ull }, K2 { 0xC2B2AE3D27D4EB4Full };
+   uint64_t h1 { K1 ^ slen }, h2 { K2 };
+   auto step = [&]( uint64_t w1, uint64_t w2 ) {
+      if constexpr( CaseInsensitive )
+      {
+         w1 = UpperCase8( w1 );
+         w2 = UpperCase8( w2 );
+      }
+      h1 = RotL64( h1 ^ w1 * K2, 29 ) * K1;
+      h2 = RotL64( h2 ^ w2 * K1, 31 ) * K2;
+   };
+   size_t i {};
+   for( ; i + 16 <= slen; i += 16 )
+   {
+      uint64_t w1, w2;
+      std::memcpy( &w1, s + i, 8 );
+      std::memcpy( &w2, s + i + 8, 8 );
+      step( w1, w2 );
+   }
+   if( i < slen )
+   {
+      uint64_t w1 {}, w2 {};
+      const size_t rest { slen - i };
+      std::memcpy( &w1, s + i, rest < 8 ? rest : 8 );
+      if( rest > 8 ) std::memcpy( &w2, s + i + 8, rest - 8 );
+      step( w1, w2 );
+   }
+   return Mix64( h1 ^ RotL64( h2, 32 ) );
+}
+
 template<typename T>
 struct THashBucket {
    char *StrP {};
    THashBucket *NextBucket {};
+   uint64_t HashVal {};// full hash of StrP, so rehashing does not need to look at the string again
    int StrNr {};
    T Obj {};
 };
@@ -58,75 +123,113 @@ protected:
    batchalloc::BatchAllocator<960> batchAllocator;
    batchalloc::BatchAllocator<1024> batchStrAllocator;
 #endif
-   std::vector<PHashBucket<T>> Buckets {};                    // sorted by order of insertion, no gaps
-   std::unique_ptr<std::vector<PHashBucket<T>>> PHashTable {};// sorted by hash value, with gaps
-   std::unique_ptr<std::vector<int>> SortMap {};
-   int HashTableSize {}, ReHashCnt {}, FCount {};
+   using TBucketList = gmsalloc::TVector<PHashBucket<T>>;
+   TBucketList Buckets {};                    // sorted by order of insertion, no gaps
+   std::unique_ptr<TBucketList> PHashTable {};// sorted by hash value, with gaps
+   std::unique_ptr<TBucketList> POldHashTable {};// previous table while growing, slots < MigratePos are moved
+   std::unique_ptr<gmsalloc::TVector<int>> SortMap {};
+   int HashTableSize {}, ReHashCnt {}, FCount {}, OldHashTableSize {}, MigratePos {};
    bool FSorted {};
 
    void ClearHashTable()
    {
       PHashTable = nullptr;
-      HashTableSize = ReHashCnt = 0;
+      POldHashTable = nullptr;
+      HashTableSize = ReHashCnt = OldHashTableSize = MigratePos = 0;
    }
 
+   // Hash table sizes are powers of two. When the table gets full, a table of twice the size is
+   // allocated and the chains of the old table are moved over a few slots at a time with every
+   // following insert, so no single AddObject has to rehash all entries.
+   static constexpr int MinHashTableSize { 1024 }, MaxHashTableSize { 1 << 30 }, MigrateSlotsPerInsert { 4 };
+
    void HashTableReset( int ACnt )
    {
-      constexpr int
-              HashSize_1 = 997,
-              HashSize_2 = 9973,
-              HashSize_3 = 99991,
-              HashSize_4 = 999979,
-              HashSize_5 = 9999991,
-              HashSize_6 = 99999989,
-              Next_1 = 1500,
-              Next_2 = 15000,
-              Next_3 = 150000,
-              Next_4 = 1500000,
-              Next_5 = 15000000,
-              Next_6 = std::numeric_limits<int>::max();
-      if( ACnt >= Next_5 )
-      {
-         HashTableSize = HashSize_6;
-         ReHashCnt = Next_6;
-      }
-      else if( ACnt >= Next_4 )
-      {
-         HashTableSize = HashSize_5;
-         ReHashCnt = Next_5;
-      }
-      else if( ACnt >= Next_3 )
+      HashTableSize = MinHashTableSize;
+      while( HashTableSize < ACnt && HashTableSize < MaxHashTableSize )
+         HashTableSize <<= 1;
+      ReHashCnt = HashTableSize < MaxHashTableSize ? HashTableSize : std::numeric_limits<int>::max();
+      PHashTable = std::make_unique<TBucketList>( HashTableSize );
+      // should be redundant due to std::vector being zero/value-initialized
+      std::fill_n( PHashTable->begin(), HashTableSize, nullptr );
+   }
+
+   // start moving the entries into a hash table of twice the size
+   void StartGrowHashTable()
+   {
+      assert( !POldHashTable );
+      POldHashTable = std::move( PHashTable );
+      OldHashTableSize = HashTableSize;
+      MigratePos = 0;
+      HashTableReset( 2 * HashTableSize );
+   }
+
+   // move the chains of the next Slots slots of the old hash table into the current one
+   void MigrateHashTable( int Slots )
+   {
+      for( ; Slots > 0 && MigratePos < OldHashTableSize; Slots--, MigratePos++ )
       {
-         HashTableSize = HashSize_4;
-         ReHashCnt = Next_4;
+         PHashBucket<T> PBuck = ( *POldHashTable )[MigratePos];
+         while( PBuck )
+         {
+            PHashBucket<T> NextBuck = PBuck->NextBucket;
+            const int HV { HashIndex( PBuck->HashVal ) };
+            PBuck->NextBucket = GetBucketByHash( HV );
+            ( *PHashTable )[HV] = PBuck;
+            PBuck = NextBuck;
+         }
       }
-      else if( ACnt >= Next_2 )
+      if( MigratePos >= OldHashTableSize )
       {
-         HashTableSize = HashSize_3;
-         ReHashCnt = Next_3;
+         POldHashTable = nullptr;
+         OldHashTableSize = MigratePos = 0;
       }
-      else if( ACnt >= Next_1 )
+   }
+
+   PHashBucket<T> FindBucket( const char *s, const uint64_t FullHV )
+   {
+      for( PHashBucket<T> PBuck = GetBucketByHash( HashIndex( FullHV ) ); PBuck; PBuck = PBuck->NextBucket )
+         if( PBuck->HashVal == FullHV && EntryEqual( PBuck->StrP, s ) ) return PBuck;
+      if( POldHashTable )
       {
-         HashTableSize = HashSize_2;
-         ReHashCnt = Next_2;
+         const int OldHV { static_cast<int>( FullHV & ( OldHashTableSize - 1 ) ) };
+         for( PHashBucket<T> PBuck = ( *POldHashTable )[OldHV]; PBuck; PBuck = PBuck->NextBucket )
+            if( PBuck->HashVal == FullHV && EntryEqual( PBuck->StrP, s ) ) return PBuck;
       }
-      else
+      return nullptr;
+   }
+
+   // remove PBuck from the chain it is in, which might still be one of the old hash table
+   void UnlinkBucket( PHashBucket<T> PBuck )
+   {
+      auto unlinkFrom = [PBuck]( PHashBucket<T> &Head ) {
+         for( PHashBucket<T> *Link = &Head; *Link; Link = &( *Link )->NextBucket )
+         {
+            if( *Link == PBuck )
+            {
+               *Link = PBuck->NextBucket;
+               return true;
+            }
+         }
+         return false;
+      };
+      if( !unlinkFrom( ( *PHashTable )[HashIndex( PBuck->HashVal )] ) )
       {
-         HashTableSize = HashSize_1;
-         ReHashCnt = Next_1;
+         assert( POldHashTable );
+         [[maybe_unused]] const bool found { unlinkFrom( ( *POldHashTable )[static_cast<int>( PBuck->HashVal & ( OldHashTableSize - 1 ) )] ) };
+         assert( found );
       }
-      PHashTable = std::make_unique<std::vector<PHashBucket<T>>>( HashTableSize );
-      // should be redundant due to std::vector being zero/value-initialized
-      std::fill_n( PHashTable->begin(), HashTableSize, nullptr );
    }
 
-   virtual int Hash( const char *s )
+   virtual uint64_t HashValue( const char *s, size_t slen )
+   {
+      return HashText<true>( s, slen );
+   }
+
+   [[nodiscard]] int HashIndex( const uint64_t HV ) const
    {
       assert( HashTableSize > 0 );
-      unsigned int res {};
-      for( int i {}; s[i] != '\0'; i++ )
-         res = 211 * res + utils::toupper( s[i] );
-      return ( res & 0x7FFFFFFF ) % HashTableSize;
+      return static_cast<int>( HV & ( HashTableSize - 1 ) );
    }
 
    virtual bool EntryEqual( const char *ps1, const char *ps2 )
@@ -142,11 +245,13 @@ protected:
    void HashAll()
    {
       if( PHashTable ) PHashTable->clear();
+      POldHashTable = nullptr;
+      OldHashTableSize = MigratePos = 0;
       HashTableReset( FCount );
       for( int N {}; N < FCount; N++ )
       {
          auto &PBuck = Buckets[N];
-         int HV = Hash( PBuck->StrP );
+         const int HV { HashIndex( PBuck->HashVal ) };
          PBuck->NextBucket = GetBucketByHash( HV );
          assert( PHashTable );
          ( *PHashTable )[HV] = PBuck;
@@ -212,7 +317,7 @@ protected:
    {
       if( !SortMap )
       {
-         SortMap = std::make_unique<std::vector<int>>( FCount );
+         SortMap = std::make_unique<gmsalloc::TVector<int>>( FCount );
          std::iota( SortMap->begin(), SortMap->end(), 0 );
          FSorted = false;
       }
@@ -259,8 +364,9 @@ public:
          delete bucket;
       }
 #else
-      batchAllocator.clear();
-      batchStrAllocator.clear();
+      // keep the batches, a cleared list is usually filled again
+      batchAllocator.reset();
+      batchStrAllocator.reset();
 #endif
       Buckets.clear();
       FCount = 0;
@@ -289,6 +395,7 @@ public:
 #endif
       Buckets.emplace_back( PBuck );
       PBuck->NextBucket = nullptr;
+      PBuck->HashVal = HashValue( s, slen );
       PBuck->StrNr = FCount;// before it was added!
       int res { FCount + ( OneBased ? 1 : 0 ) };
       if( SortMap )
@@ -310,15 +417,14 @@ public:
    int AddObject( const char *s, size_t slen, T AObj )
    {
       assert( FCount < std::numeric_limits<int>::max() );
-      if( FCount >= ReHashCnt ) HashAll();
-      int HV { Hash( s ) };
-      PHashBucket<T> PBuck = GetBucketByHash( HV );
-      while( PBuck )
-      {
-         if( !EntryEqual( PBuck->StrP, s ) ) PBuck = PBuck->NextBucket;
-         else
-            return PBuck->StrNr + ( OneBased ? 1 : 0 );
-      }
+      if( !PHashTable ) HashAll();
+      const uint64_t FullHV { HashValue( s, slen ) };
+      PHashBucket<T> PBuck = FindBucket( s, FullHV );
+      if( PBuck ) return PBuck->StrNr + ( OneBased ? 1 : 0 );
+      if( POldHashTable ) MigrateHashTable( MigrateSlotsPerInsert );
+      else if( FCount >= ReHashCnt )
+         StartGrowHashTable();
+      const int HV { HashIndex( FullHV ) };
 #ifdef TSH_BATCH_ALLOCS
       PBuck = reinterpret_cast<PHashBucket<T>>( batchAllocator.GetBytes( sizeof( THashBucket<T> ) ) );
 #else
@@ -326,6 +432,7 @@ public:
 #endif
       Buckets.emplace_back( PBuck );
       PBuck->NextBucket = GetBucketByHash( HV );
+      PBuck->HashVal = FullHV;
       ( *PHashTable )[HV] = PBuck;
       PBuck->StrNr = FCount;// before it was added! zero based
       int res { FCount + ( OneBased ? 1 : 0 ) };
@@ -358,15 +465,8 @@ public:
    int IndexOf( const char *s )
    {
       if( !PHashTable ) HashAll();
-      const int HV { Hash( s ) };
-      PHashBucket<T> PBuck = GetBucketByHash( HV );
-      while( PBuck )
-      {
-         if( !EntryEqual( PBuck->StrP, s ) ) PBuck = PBuck->NextBucket;
-         else
-            return PBuck->StrNr + ( OneBased ? 1 : 0 );
-      }
-      return -1;
+      const PHashBucket<T> PBuck = FindBucket( s, HashValue( s, std::strlen( s ) ) );
+      return PBuck ? PBuck->StrNr + ( OneBased ? 1 : 0 ) : -1;
    }
 
    template<typename T2>
@@ -403,6 +503,7 @@ public:
          res += std::strlen( Buckets[N]->StrP ) + 1;
       res += static_cast<int>( Buckets.size() * sizeof( THashBucket<T> ) );
       if( PHashTable ) res += static_cast<int>( PHashTable->size() * sizeof( THashBucket<T> ) );
+      if( POldHashTable ) res += static_cast<int>( POldHashTable->size() * sizeof( THashBucket<T> ) );
       if( SortMap ) res += static_cast<int>( SortMap->size() * sizeof( int ) );
       return res;
    }
@@ -415,23 +516,16 @@ public:
          SortMap = nullptr;
          FSorted = false;
       }
+      const size_t slen { std::strlen( s ) };
+      PHashBucket<T> PBuck = Buckets[N];
+      if( PHashTable ) UnlinkBucket( PBuck );
+      SetString( N + ( OneBased ? 1 : 0 ), s, slen );
       if( PHashTable )
       {
-         int HV0 { Hash( GetString( N + 1 ) ) }, HV1 { Hash( s ) };
-         if( HV0 != HV1 )
-         {
-            PHashBucket<T> PrevBuck {}, PBuck;
-            for( PBuck = GetBucketByHash( HV0 );
-                 PBuck->StrNr != N; PBuck = PBuck->NextBucket )
-               PrevBuck = PBuck;
-            if( !PrevBuck ) ( *PHashTable )[HV0] = PBuck->NextBucket;
-            else
-               PrevBuck->NextBucket = PBuck->NextBucket;
-            PBuck->NextBucket = GetBucketByHash( HV1 );
-            ( *PHashTable )[HV1] = PBuck;
-         }
+         const int HV { HashIndex( PBuck->HashVal ) };
+         PBuck->NextBucket = GetBucketByHash( HV );
+         ( *PHashTable )[HV] = PBuck;
       }
-      SetString( N + 1, s, std::strlen( s ) );
    }
 
    T *operator[]( const int N )
@@ -464,13 +558,14 @@ public:
    {
       auto bucket = Buckets[N - ( OneBased ? 1 : 0 )];
 #ifdef TSH_BATCH_ALLOCS
-      // Storage for old string will leak temporarily but will be collected by batchAllocator.clear call
+      // Storage for old string will leak temporarily but will be reused after the next Clear call
       bucket->StrP = reinterpret_cast<char *>( batchStrAllocator.GetBytes( slen + 1 ) );
 #else
       delete[] bucket->StrP;
       bucket->StrP = new char[slen + 1];
 #endif
       utils::assignPCharToBuf( s, slen, bucket->StrP );
+      bucket->HashVal = HashValue( s, slen );
    }
 
    [[nodiscard]] char *GetSortedString( const int N ) const
@@ -561,13 +656,9 @@ template<typename T>
 class TXCSStrHashList : public TXStrHashList<T>
 {
 protected:
-   int Hash( const char *s ) override
+   uint64_t HashValue( const char *s, size_t slen ) override
    {
-      assert( this->HashTableSize > 0 );
-      unsigned int res {};
-      for( int i {}; s[i] != '\0'; i++ )
-         res = 211 * res + s[i];
-      return ( res & 0x7FFFFFFF ) % this->HashTableSize;
+      return HashText<false>( s, slen );
    }
 
    bool EntryEqual( const char *ps1, const char *ps2 ) override
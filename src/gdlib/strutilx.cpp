@@ -329,6 +329,231 @@ static uint8_t DblToStrSepCore(double V, const char DecimalSep, char *s)
    return ui8(slen);
 }
 
+// 64 x 64 -> 128 bit product split into high and low word
+static void Mul64( const uint64_t a, const uint64_t b, uint64_t &hi, uint64_t &lo )
+{
+#if defined( __SIZEOF_INT128__ )
+   __extension__ using uint128 = unsigned __int128;
+   const auto p { static_cast<uint128>( a ) * b };
+   hi = static_cast<uint64_t>( p >> 64 );
+   lo = static_cast<uint64_t>( p );
+#else
+   const uint64_t aL { a & 0xFFFFFFFF }, aH { a >> 32 }, bL { b & 0xFFFFFFFF }, bH { b >> 32 };
+   const uint64_t ll { aL * bL }, lh { aL * bH }, hl { aH * bL }, hh { aH * bH };
+   const uint64_t mid { ( ll >> 32 ) + ( lh & 0xFFFFFFFF ) + ( hl & 0xFFFFFFFF ) };
+   hi = hh + ( lh >> 32 ) + ( hl >> 32 ) + ( mid >> 32 );
+   lo = ( mid << 32 ) | ( ll & 0xFFFFFFFF );
+#endif
+}
+
+// 10^k is approximately (Hi * 2^64 + Lo) * 2^Exp with the top bit of Hi set
+struct TPow10 {
+   uint64_t Hi, Lo;
+   int Exp;
+};
+
+constexpr int Pow10Min { -300 }, Pow10Max { 345 };
+
+// Built once with 192 bit mantissas by repeated multiplication and division by 10,
+// so the 128 bits kept are accurate to about one unit in the last place
+static const std::array<TPow10, Pow10Max - Pow10Min + 1> &Pow10Table()
+{
+   static const auto table { [] {
+      std::array<TPow10, Pow10Max - Pow10Min + 1> res {};
+      constexpr int nLimbs { 6 };
+      auto store = []( const std::array<uint32_t, nLimbs> &m, const int e ) {
+         return TPow10 { uint64_t { m[5] } << 32 | m[4], uint64_t { m[3] } << 32 | m[2], e + 64 };
+      };
+      const std::array<uint32_t, nLimbs> one { 0, 0, 0, 0, 0, 0x80000000 };
+      auto m { one };
+      int e { -191 };
+      res[-Pow10Min] = store( m, e );
+      for( int k { 1 }; k <= Pow10Max; k++ )
+      {
+         uint64_t carry {};
+         for( auto &limb: m )
+         {
+            const uint64_t t { uint64_t { limb } * 10 + carry };
+            limb = static_cast<uint32_t>( t );
+            carry = t >> 32;
+         }
+         while( carry )
+         {
+            for( int i {}; i < nLimbs - 1; i++ )
+               m[i] = m[i] >> 1 | m[i + 1] << 31;
+            m[nLimbs - 1] = m[nLimbs - 1] >> 1 | static_cast<uint32_t>( carry << 31 );
+            carry >>= 1;
+            e++;
+         }
+         res[k - Pow10Min] = store( m, e );
+      }
+      m = one;
+      e = -191;
+      for( int k { -1 }; k >= Pow10Min; k-- )
+      {
+         uint64_t rem {};
+         for( int i { nLimbs - 1 }; i >= 0; i-- )
+         {
+            const uint64_t t { rem << 32 | m[i] };
+            m[i] = static_cast<uint32_t>( t / 10 );
+            rem = t % 10;
+         }
+         while( !( m[nLimbs - 1] & 0x80000000 ) )
+         {
+            for( int i { nLimbs - 1 }; i > 0; i-- )
+               m[i] = m[i] << 1 | m[i - 1] >> 31;
+            m[0] <<= 1;
+            e--;
+         }
+         res[k - Pow10Min] = store( m, e );
+      }
+      return res;
+   }() };
+   return table;
+}
+
+// Brief:
+//   Computes the 15 significant digits of a positive finite double rounded to nearest
+// Parameters:
+//   V: Value to be converted
+//   Digits: Receives the digits without trailing zeros
+//   E: Receives the decimal exponent of the first digit
+// Returns:
+//   Number of digits written, 0 when V is too close to a rounding tie to decide without exact arithmetic
+static int DblToDigits15( const double V, char *Digits, int &E )
+{
+   constexpr uint64_t lowBound { 100000000000000 }, highBound { 1000000000000000 }, half { uint64_t { 1 } << 63 };
+   uint64_t bits;
+   std::memcpy( &bits, &V, sizeof( double ) );
+   int q { static_cast<int>( bits >> 52 & 0x7FF ) };
+   uint64_t m { bits & ( ( uint64_t { 1 } << 52 ) - 1 ) };
+   if( q )
+      m |= uint64_t { 1 } << 52;
+   else
+      q = 1;
+   q -= 1075;
+   // V = m * 2^q with the top bit of m set
+   while( !( m & half ) )
+   {
+      m <<= 1;
+      q--;
+   }
+   // estimate of floor(log10(V)), corrected below when off by one
+   E = static_cast<int>( std::floor( ( q + 63 ) * 0.30102999566398120 ) );
+   uint64_t n {};
+   uint64_t frac {};
+   for( int tries {}; ; tries++ )
+   {
+      if( tries == 3 || 14 - E < Pow10Min || 14 - E > Pow10Max )
+         return 0;
+      const TPow10 &p { Pow10Table()[14 - E - Pow10Min] };
+      uint64_t hH, hL, lH, lL;
+      Mul64( m, p.Hi, hH, hL );
+      Mul64( m, p.Lo, lH, lL );
+      const uint64_t w1 { hL + lH };
+      const uint64_t w2 { hH + ( w1 < hL ) };
+      // V * 10^(14-E) = (w2, w1, lL) * 2^(q + p.Exp), whose integer part lies in the top word
+      const int r { -( q + p.Exp ) - 128 };
+      if( r <= 0 || r >= 64 )
+         return 0;
+      n = w2 >> r;
+      frac = w2 << ( 64 - r ) | w1 >> r;
+      if( n >= highBound )
+         E++;
+      else if( n < lowBound )
+         E--;
+      else
+         break;
+   }
+   // the product is accurate to a few units of the last fraction bit, so only values very close to a tie are ambiguous
+   if( frac > half - 16 && frac < half + 16 )
+      return 0;
+   if( frac > half && ++n == highBound )
+   {
+      n = lowBound;
+      E++;
+   }
+   int nDigits { 15 };
+   while( n % 10 == 0 )
+   {
+      n /= 10;
+      nDigits--;
+   }
+   for( int i { nDigits - 1 }; i >= 0; i-- )
+   {
+      Digits[i] = static_cast<char>( '0' + n % 10 );
+      n /= 10;
+   }
+   return nDigits;
+}
+
+// Brief:
+//   Formats a nonzero double like DblToStrSepCore followed by removing the blanks
+// Returns:
+//   Length of the string written to s, 0 when DblToStrSepCore has to be used instead
+static uint8_t DblToStrSepFast( const double V, const char DecimalSep, char *s )
+{
+   if( !std::isfinite( V ) )
+      return 0;
+   std::array<char, 16> digits;
+   int e;
+   const int nDigits { DblToDigits15( std::abs( V ), digits.data(), e ) };
+   if( !nDigits )
+      return 0;
+   char *d { s };
+   if( V < 0.0 )
+      *d++ = '-';
+   const double absV { std::abs( V ) };
+   if( absV >= 1e-4 && absV < 1e15 )
+   {
+      if( e >= 0 )
+      {
+         for( int i {}; i <= e; i++ )
+            *d++ = i < nDigits ? digits[i] : '0';
+         if( nDigits > e + 1 )
+         {
+            *d++ = DecimalSep;
+            for( int i { e + 1 }; i < nDigits; i++ )
+               *d++ = digits[i];
+         }
+      }
+      else
+      {
+         *d++ = '0';
+         *d++ = DecimalSep;
+         for( int i { e + 1 }; i < 0; i++ )
+            *d++ = '0';
+         for( int i {}; i < nDigits; i++ )
+            *d++ = digits[i];
+      }
+   }
+   else
+   {
+      *d++ = digits[0];
+      if( nDigits > 1 )
+      {
+         *d++ = '.';
+         for( int i { 1 }; i < nDigits; i++ )
+            *d++ = digits[i];
+      }
+      *d++ = 'E';
+      if( e < 0 )
+      {
+         *d++ = '-';
+         e = -e;
+      }
+      char *first { d };
+      do
+      {
+         *d++ = static_cast<char>( '0' + e % 10 );
+         e /= 10;
+      } while( e );
+      std::reverse( first, d );
+   }
+   *d = '\0';
+   return ui8( d - s );
+}
+
 // Closer port of corresponding Delphi function (faster?)
 // Brief:
 //   Convert a double to its string representation
@@ -342,6 +567,8 @@ std::string DblToStrSep( double V, const char DecimalSep )
    if( V == 0.0 )
       return "0"s;
    sstring s;
+   if( const auto len { DblToStrSepFast( V, DecimalSep, s.data() ) } )
+      return { s.data(), len };
    const auto slen { DblToStrSepCore( V, DecimalSep, s.data() ) };
    // only with short strings
    std::string res;
@@ -358,19 +585,16 @@ uint8_t DblToStrSep(double V, const char DecimalSep, char* sout)
       sout[1] = '\0';
       return 1;
    }
+   if( const auto len { DblToStrSepFast( V, DecimalSep, sout ) } )
+      return len;
    uint8_t slen = DblToStrSepCore( V, DecimalSep, sout );
    // only with short strings
    int i {};
-   for( int l {}; l < slen; i++, l++ )
-   {
-      if( sout[l] == ' ' )
-      {
-         while( sout[++l] == ' ' && sout[l] != '\0' )
-            ;
-      }
-      sout[i] = sout[l];
-   }
-   return ui8(i - 1);
+   for( int l {}; l < slen; l++ )
+      if( sout[l] != ' ' )
+         sout[i++] = sout[l];
+   sout[i] = '\0';
+   return ui8(i);
 }
 
 std::string DblToStr( const double V )
@@ -32,6 +32,20 @@
 namespace gdx
 {
 
+/**
+ * @brief Install procedures that provide the memory for the containers of all GDX objects.
+ * @details The procedures apply to the whole process, i.e. to all GDX objects in all threads, not to a single file object.
+ *   AllocProc receives the size and the alignment of a block, FreeProc the block and its size, both also receive Uptr.
+ *   Blocks that were allocated before are still freed by the procedure that allocated them, so the procedures can be
+ *   changed at any time, e.g. to account the memory of different phases of an application separately. Passing
+ *   nullptr for both procedures restores the default allocator.
+ * @param AllocProc Allocation procedure, returns nullptr if out of memory.
+ * @param FreeProc Procedure to free a block obtained from AllocProc.
+ * @param Uptr User pointer that will be passed to both procedures.
+ * @return Non-zero if successful, zero if only one of the procedures was given.
+ */
+int gdxSetAllocator( gdlib::gmsalloc::TAllocProc AllocProc, gdlib::gmsalloc::TFreeProc FreeProc, void *Uptr );
+
 /// @details Class for reading and writing GDX files through a efficient low-level interface
 class TGXFileObj
 {
@@ -112,6 +126,57 @@ public:
     */
    void gdxMapAcronymsToNaNSet(int flag);
 
+   /**
+    * @brief Get flag to store the major index of the next file opened for writing in a fixed-size trailer at the
+    *   end of the file instead of patching it into the header on close. Such files are written strictly
+    *   append-only, so they can be written to sinks that do not support seeking (pipes etc.). Disabled by
+    *   default.
+    * @return 1 (true) iff. flag is set, 0 (false) otherwise.
+    */
+   [[nodiscard]] int gdxFooterIndex() const;
+
+   /**
+    * @brief Set flag to store the major index of the next file opened for writing in a fixed-size trailer at the
+    *   end of the file instead of patching it into the header on close. Such files are written strictly
+    *   append-only, so they can be written to sinks that do not support seeking (pipes etc.). Readers
+    *   detect this variant from the file header. Files written this way cannot be read by GDX libraries
+    *   that predate this option. Disabled by default.
+    * @param flag 1 (true) to enable and 0 (false) to disable flag.
+    */
+   void gdxFooterIndexSet(int flag);
+
+   /**
+    * @brief Get the maximum number of error records stored per symbol (see gdxDataErrorCount). Further error
+    *   records are only counted (see gdxDataErrorOverflowCount). A negative value means no limit. The
+    *   default is 11.
+    * @return Current value.
+    */
+   [[nodiscard]] int gdxDataErrorLimit() const;
+
+   /**
+    * @brief Set the maximum number of error records stored per symbol (see gdxDataErrorCount). Further error
+    *   records are only counted (see gdxDataErrorOverflowCount). A negative value means no limit. The
+    *   default is 11.
+    * @param flag New value.
+    */
+   void gdxDataErrorLimitSet(int flag);
+
+   /**
+    * @brief Get flag to compute a fingerprint of the records of every symbol written and store it in the file.
+    *   Disabled by default.
+    * @return 1 (true) iff. flag is set, 0 (false) otherwise.
+    */
+   [[nodiscard]] int gdxStoreFingerprints() const;
+
+   /**
+    * @brief Set flag to compute a fingerprint of the records of every symbol written and store it in the file.
+    *   The fingerprint is a hash over the UEL strings, set texts and values of the records, so it does not
+    *   depend on the UEL numbering or record order of the file (see gdxSymbolFingerprint). Files written
+    *   this way remain readable by older GDX libraries. Disabled by default.
+    * @param flag 1 (true) to enable and 0 (false) to disable flag.
+    */
+   void gdxStoreFingerprintsSet(int flag);
+
    /**
     * @brief Add an alias for a set to the symbol table. One of the two identifiers has to be a known set, an
     *   alias or "*" (universe); the other identifier is used as the new alias for the given set. The
@@ -511,7 +576,8 @@ public:
     *   be used. The return code is a system dependent I/O error. If the file was found, but is not a valid
     *   GDX file, the function GetLastError can be used to handle these type of errors.
     * @param FileName File name of the GDX file to be opened (arbitrary length).
-    * @param ReadMode Bitmap skip reading sections: 0-bit: string (1 skip reading string).
+    * @param ReadMode Bitmap skip reading sections: 0-bit: string (1 skip reading string), 1-bit: header only (2 defers
+    *   reading the UEL, set text and acronym sections until they are needed).
     * @param ErrNr Returns an error code or zero if there is no error.
     * @return Returns non-zero if the file can be opened; zero otherwise.
     * @code
@@ -688,7 +754,7 @@ public:
     *   the file and the duplicates are added to the error list. When reading data using a filtered read
     *   operation, data records that were filtered out because an index is not in the user index space or
     *   not in a filter are added the error list.
-    * @return The number of error records available.
+    * @return The number of error records available, capped at the largest int value.
     * @see gdxDataErrorRecord
     */
    int gdxDataErrorCount() const;
@@ -932,8 +998,8 @@ public:
    /**
     * @brief Initialize the reading of a symbol in raw mode. Returns zero if the operation is not possible.
     * @param SyNr The index number of the symbol, range 0..NrSymbols; SyNr = 0 reads universe.
-    * @param NrRecs The maximum number of records available for reading. The actual number of records may be less when a
-    *   filter is applied to the records read.
+    * @param NrRecs The maximum number of records available for reading (capped at 2^31-1, see gdxDataReadRawStart64).
+    *   The actual number of records may be less when a filter is applied to the records read.
     * @return Non-zero if the operation is possible, zero otherwise.
     * @see gdxDataReadRaw, gdxDataReadMapStart, gdxDataReadStrStart, gdxDataReadDone
     */
@@ -1025,6 +1091,74 @@ public:
     */
    int gdxDataSliceUELS( const int *SliceKeyInt, char **KeyStr );
 
+   /**
+    * @brief Initialize the reading of a symbol in raw mode like gdxDataReadRawStart but returns the number of
+    *   records as 64 bit integer, so it can be used for symbols with more than 2^31-1 records. Returns zero
+    *   if the operation is not possible.
+    * @param SyNr The index number of the symbol, range 0..NrSymbols; SyNr = 0 reads universe.
+    * @param NrRecs The maximum number of records available for reading as 64 bit integer. The actual number of records
+    *   may be less when a filter is applied to the records read.
+    * @return Non-zero if the operation is possible, zero otherwise.
+    * @see gdxDataReadRawStart, gdxDataReadRaw, gdxDataReadDone
+    */
+   int gdxDataReadRawStart64( int SyNr, int64_t &NrRecs );
+
+   /**
+    * @brief Initialize the reading of a symbol in mapped mode like gdxDataReadMapStart but returns the number of
+    *   records as 64 bit integer, so it can be used for symbols with more than 2^31-1 records. Returns zero
+    *   if the operation is not possible.
+    * @param SyNr The index number of the symbol, range 0..NrSymbols; SyNr = 0 reads universe.
+    * @param NrRecs The maximum number of records available for reading as 64 bit integer. The actual number of records
+    *   may be less when a filter is applied to the records read.
+    * @return Non-zero if the operation is possible, zero otherwise.
+    * @see gdxDataReadMapStart, gdxDataReadMap, gdxDataReadDone
+    */
+   int gdxDataReadMapStart64( int SyNr, int64_t &NrRecs );
+
+   /**
+    * @brief Initialize the reading of a symbol in string mode like gdxDataReadStrStart but returns the number of
+    *   records as 64 bit integer, so it can be used for symbols with more than 2^31-1 records. Returns zero
+    *   if the operation is not possible.
+    * @param SyNr The index number of the symbol, range 0..NrSymbols; SyNr = 0 reads universe.
+    * @param NrRecs The number of records available for reading as 64 bit integer.
+    * @return Non-zero if the operation is possible, zero otherwise.
+    * @see gdxDataReadStrStart, gdxDataReadStr, gdxDataReadDone
+    */
+   int gdxDataReadStrStart64( int SyNr, int64_t &NrRecs );
+
+   /**
+    * @brief Query the number of error records of the current symbol that were only counted because the error
+    *   list was full (see gdxDataErrorLimit).
+    * @return The number of error records not stored because of the error record limit, capped at the largest int
+    *   value.
+    * @see gdxDataErrorCount, gdxDataErrorRecords
+    */
+   int gdxDataErrorOverflowCount() const;
+
+   /**
+    * @brief Retrieve a range of error records at once like gdxDataErrorRecordX. Returns the number of records
+    *   retrieved.
+    * @param RecNr The number of the first record to be retrieved (range 1..NrErrorRecords).
+    * @param Cnt The maximum number of records to be retrieved.
+    * @param KeyInt Indices of the records, one UEL index per dimension for each record one after the other; negative
+    *   uel indicates domain violation for filtered/strict read.
+    * @param Values Values of the records, GMS_VAL_MAX (=5) values (level, marginal, lower-, upper-bound, scale) for
+    *   each record one after the other, i.e. the values of the i-th record retrieved start at
+    *   Values[i*GMS_VAL_MAX].
+    * @attention <ul>
+    *  <li>
+    *   KeyInt must be big enough to hold Cnt times the dimension of the symbol UEL indices!
+    *  </li>
+    *  <li>
+    *   Values must have length &gt;=GMS_VAL_MAX*Cnt; the stride between records is always GMS_VAL_MAX,
+    *   independent of the symbol type.
+    *  </li>
+    * </ul>
+    * @return The number of records retrieved, zero if the record number is out of range.
+    * @see gdxDataErrorRecordX, gdxDataErrorCount
+    */
+   int gdxDataErrorRecords( int RecNr, int Cnt, int *KeyInt, double *Values );
+
    /// @}
 
 
@@ -1202,6 +1336,50 @@ public:
     */
    int gdxCurrentDim() const;
 
+   /**
+    * @brief Returns additional information about a symbol like gdxSymbolInfoX but with the record count as 64
+    *   bit integer. Returns zero if the symbol number is out of range, non-zero otherwise.
+    * @param SyNr The symbol number (range 0..NrSymbols); return universe info when SyNr = 0.
+    * @param RecCnt Total number of records stored (unmapped) as 64 bit integer; for the universe (SyNr = 0) this is the
+    *   number of entries when the GDX file was opened for reading.
+    * @param UserInfo User field value storing additional data (see gdxSymbolInfoX).
+    * @param ExplTxt Explanatory text for the symbol. Buffer for this output argument should be 256 bytes long.
+    * @attention Make sure the output argument string buffer for ExplTxt has size of 256 bytes.
+    * @return Zero if the symbol number is not in the correct range, non-zero otherwise.
+    * @see gdxSymbolInfoX, gdxSystemInfo
+    */
+   int gdxSymbolInfoX64( int SyNr, int64_t &RecCnt, int &UserInfo, char *ExplTxt );
+
+   /**
+    * @brief Retrieve the fingerprint of the records of a symbol stored when the file was written (see
+    *   gdxStoreFingerprints). The fingerprint does not depend on the UEL numbering of the file. Symbols
+    *   with different fingerprints have different records; symbols with the same fingerprint almost
+    *   certainly have the same records, but as for any 64 bit hash different records can collide. Returns
+    *   zero if the file holds no fingerprint for the symbol.
+    * @param SyNr The symbol number (range 1..NrSymbols); an alias gives the fingerprint of the aliased set.
+    * @param Fingerprint The fingerprint as 16 hexadecimal digits, empty if not available.
+    * @return Non-zero if the symbol has a fingerprint, zero otherwise.
+    * @see gdxStoreFingerprints, gdxSymbolDataBytes
+    */
+   int gdxSymbolFingerprint( int SyNr, char *Fingerprint );
+
+   /**
+    * @brief Copy a range of the data of a symbol as stored in the file, without decoding the records. Comparing
+    *   these bytes range by range tells whether two symbols are stored identically; this implies the same
+    *   records only if both files have the same UEL table, set texts and acronyms. Returns the number of
+    *   bytes copied, which is less than Count once the end of the data is reached.
+    * @details The file must be open for reading and no read may be in progress, i.e. gdxDataReadDone must have
+    *   been called after reading data.
+    * @param SyNr The symbol number (range 1..NrSymbols); an alias gives the data of the aliased set.
+    * @param Offset Position of the first byte to copy, relative to the start of the data of the symbol.
+    * @param Count The maximum number of bytes to copy.
+    * @param Buffer Receives the bytes; must be able to hold Count bytes.
+    * @return The number of bytes copied, zero if Offset is at or behind the end of the data, -1 if the symbol has
+    *   no stored data or a read is in progress.
+    * @see gdxSymbolFingerprint
+    */
+   int gdxSymbolDataBytes( int SyNr, int64_t Offset, int Count, void *Buffer );
+
    /// @}
 
 
@@ -1754,7 +1932,7 @@ enum : uint8_t
    stat_write
 } fstatus { stat_notopen };
 int fComprLev {};
-std::unique_ptr<TUELTable> UELTable;
+std::unique_ptr<UELTableImplChoice> UELTable;
 std::unique_ptr<TSetTextList> SetTextList {};
 std::unique_ptr<int[]> MapSetText {};
 int FCurrentDim {};
@@ -1763,17 +1941,31 @@ std::array<std::array<char, GLOBAL_UEL_IDENT_SIZE>, GLOBAL_MAX_INDEX_DIM> LastSt
 int DataSize {};
 tvarvaltype LastDataField {};
 std::unique_ptr<TNameList> NameList;
+TSymbolArena SymbolArena;
 std::unique_ptr<TDomainStrList> DomainStrList;
 std::unique_ptr<LinkedDataType> SortList;
+std::unique_ptr<LinkedDataType> SpareSortList;// sort list of the previous symbol, its memory is reused by NewSortList
 std::optional<LinkedDataIteratorType> ReadPtr;
-std::unique_ptr<TTblGamsDataImpl<double>> ErrorList;
+std::unique_ptr<TErrorList> ErrorList;
 PgdxSymbRecord CurSyPtr {};
-int ErrCnt {}, ErrCntTotal {};
+int64_t ErrCnt {};
+int ErrCntTotal {};
 int LastError {}, LastRepError {};
 std::unique_ptr<TFilterList> FilterList;
 TDFilter *CurFilter {};
 TDomainList DomainList {};
 bool StoreDomainSets { true }, AllowBogusDomain { true }, MapAcrToNaN {};
+int ErrorLimit { 11 };// error records stored per symbol, < 0: no limit
+bool FooterIndex {};   // option: new files get their major index in a trailer
+bool StoreFingerprints {};// option: store a fingerprint of the records of every symbol written
+bool IndexInTrailer {};// the open file keeps its major index in a trailer
+bool UELsDeferred {}, AcronymsDeferred {};// header-only open: sections not read yet
+int64_t DeferredUELPos {}, DeferredSetTextPos {}, DeferredAcronymPos {};
+int DeferredUelCnt {};
+uint64_t FingerprintSum {};                                           // sum of the record hashes of the current symbol
+std::array<uint64_t, GLOBAL_MAX_INDEX_DIM + 1> FingerprintPrefix {};// hash of the UEL strings up to each dimension
+int64_t SymbolTablePos {};
+std::vector<int64_t> DataPositions;// sorted start positions of all symbol data (gdxSymbolDataBytes)
 TIntlValueMapDbl intlValueMapDbl {}, readIntlValueMapDbl {};
 TIntlValueMapI64 intlValueMapI64 {};
 TraceLevels TraceLevel { TraceLevels::trl_all };
@@ -1782,7 +1974,8 @@ int VersionRead {};
 std::string FProducer, FProducer2, FileSystemID;
 int64_t MajorIndexPosition {};
 int64_t NextWritePosition {};
-int DataCount {}, NrMappedAdded {};
+int64_t DataCount {};
+int NrMappedAdded {};
 std::array<TgdxElemSize, GLOBAL_MAX_INDEX_DIM> ElemType {};
 std::string MajContext;
 std::array<TIntegerMapping, GLOBAL_MAX_INDEX_DIM> SliceIndxs {}, SliceRevMap {};
@@ -1814,7 +2007,11 @@ TDataStoreFiltProc_t gdxDataReadRawFastFilt_DP {};
 TDomainIndexProc_t gdxGetDomainElements_DP {};
 
 bool PrepareSymbolWrite( std::string_view Caller, const char *AName, const char *AText, int ADim, int AType, int AUserInfo );
-int PrepareSymbolRead( std::string_view Caller, int SyNr, const int *ADomainNrs, TgxFileMode newmode );
+int64_t PrepareSymbolRead( std::string_view Caller, int SyNr, const int *ADomainNrs, TgxFileMode newmode );
+bool ReadUELsAndSetTexts( int64_t UELPos, int64_t SetTextPos, int64_t AcronymPos );
+bool ReadAcronyms( int64_t AcronymPos );
+bool LoadDeferredSections() const;
+bool LoadDeferredAcronyms() const;
 
 void InitErrors();
 void SetError( int N );
@@ -1829,11 +2026,16 @@ bool CheckMode( std::string_view Routine, TgxFileMode m );
 bool CheckMode( std::string_view Routine, const TgxModeSet &MS );
 
 void WriteTrace( std::string_view s ) const;
-void InitDoWrite( int NrRecs );
+void InitDoWrite( int64_t NrRecs );
 bool DoWrite( const int *AElements, const double *AVals );
 bool DoRead( double *AVals, int &AFDim );
+uint64_t FingerprintKeys( const int *AElements, int FirstChanged );
+uint64_t FingerprintValue( uint64_t H, double X, uint8_t xv ) const;
+const TgdxSymbRecord *SymbolWithData( int SyNr ) const;
 void AddToErrorListDomErrs( const std::array<int, GLOBAL_MAX_INDEX_DIM> &AElements, const double *AVals );
 void AddToErrorList( const int *AElements, const double *AVals );
+void NewSortList();
+void ReleaseSortList();
 void GetDefaultRecord( double *Avals ) const;
 double AcronymRemap( double V );
 bool IsGoodNewSymbol( const char *s );
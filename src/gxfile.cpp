@@ -129,8 +129,6 @@ static const auto opSysStr { "UnknownOS"s };
 
 static const auto auditLine { "GDX Library C++ V7 (AUDIT) "s + __TIMESTAMP__ + " "s + archStr + " "s + opSysStr };
 
-using UELTableImplChoice = TUELTable;
-
 //version = 5 has 32 bit offsets and no compression
 //version = 6 introduced compression
 //version 7 introduces:
@@ -139,11 +137,20 @@ using UELTableImplChoice = TUELTable;
 //      aliases
 //later without bumping version
 //      relaxed domains
-constexpr int  VERSION = 7,    //--file version
+//version 8 introduces:
+//      64 bit record and error counts in the symbol table
+//      only written when a symbol has more than 2^31-1 records or for append-only files,
+//      so all other files stay readable for older versions of the library
+constexpr int  VERSION = 8,    //--file version
+               VERSION_INT32_COUNTS = 7,//--last version with 32 bit record counts
                gdxHeaderNr = 123;//--patterns to recognize
 const std::string gdxHeaderId = "GAMSGDX";
 
-constexpr int MARK_BOI = 19510624;
+constexpr int MARK_BOI = 19510624,
+              MARK_EOI = -MARK_BOI;// major index is stored in the trailer (append-only files)
+
+// major index block: MARK_BOI followed by room for 10 int64 offsets
+constexpr int64_t MajorIndexSize = sizeof( int ) + 10 * sizeof( int64_t );
 
 const std::string
         MARK_UEL = "_UEL_"s,
@@ -151,10 +158,44 @@ const std::string
         MARK_DATA = "_DATA_"s,
         MARK_SETT = "_SETT_"s,
         MARK_ACRO = "_ACRO_"s,
-        MARK_DOMS = "_DOMS_"s;
+        MARK_DOMS = "_DOMS_"s,
+        MARK_FPRT = "_FPRT_"s;
 
 constexpr int INDEX_INITIAL = -256;
 
+// Symbol fingerprints use 64 bit FNV-1a. The records of a symbol are hashed one by one
+// and the mixed record hashes are summed, so the fingerprint does not depend on the record order.
+constexpr uint64_t FnvOffsetBasis { 0xcbf29ce484222325ULL }, FnvPrime { 0x100000001b3ULL };
+
+static uint64_t FnvAdd( uint64_t H, const void *P, size_t N )
+{
+   const auto *B = static_cast<const uint8_t *>( P );
+   for( size_t i {}; i < N; i++ )
+      H = ( H ^ B[i] ) * FnvPrime;
+   return H;
+}
+
+static uint64_t MixHash( uint64_t H )
+{
+   H = ( H ^ ( H >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+   H = ( H ^ ( H >> 27 ) ) * 0x94d049bb133111ebULL;
+   return H ^ ( H >> 31 );
+}
+
+static std::string HashToHex( uint64_t H )
+{
+   std::string res( 16, '0' );
+   for( int i { 15 }; i >= 0; i--, H >>= 4 )
+      res[i] = "0123456789abcdef"[H & 15];
+   return res;
+}
+
+// record count for the 32 bit API, symbols with more records must be queried with the ...64 variants
+static int RecordCount32( const int64_t NrRecs )
+{
+   return static_cast<int>( std::min<int64_t>( NrRecs, std::numeric_limits<int>::max() ) );
+}
+
 const std::array fmode_str {
         "FileNotOpen"s, //f_not_open
         "ReadCommand"s, //fr_init
@@ -432,12 +473,15 @@ int TGXFileObj::gdxOpenWriteEx( const char *FileName, const char *Producer, int
    InitErrors();
    NameList = std::make_unique<TNameList>();
    NameList->OneBased = true;
+   SymbolArena.Clear();
    UELTable = std::make_unique<UELTableImplChoice>();
    AcronymList = std::make_unique<TAcronymList>();
    FilterList = std::make_unique<TFilterList>();
+   IndexInTrailer = FooterIndex;
    FFile->WriteByte( gdxHeaderNr );
    FFile->WriteString( gdxHeaderId );
-   VersionRead = VERSION;
+   // append-only files cannot patch the version at close, so they always use the newest version
+   VersionRead = IndexInTrailer ? VERSION : VERSION_INT32_COUNTS;
    FFile->WriteInteger( VersionRead );
    FFile->WriteInteger( Compr );
    FileSystemID = auditLine;
@@ -445,9 +489,18 @@ int TGXFileObj::gdxOpenWriteEx( const char *FileName, const char *Producer, int
    FProducer = Producer;
    FProducer2.clear();
    FFile->WriteString( FProducer );
-   // Reserve some space for positions
-   MajorIndexPosition = FFile->GetPosition();
-   for( int N { 1 }; N <= 10; N++ ) FFile->WriteInt64( 0 );
+   if( IndexInTrailer )
+   {
+      // Positions go into a trailer written by gdxClose, so we never have to seek back
+      FFile->WriteInteger( MARK_EOI );
+      MajorIndexPosition = -1;
+   }
+   else
+   {
+      // Reserve some space for positions
+      MajorIndexPosition = FFile->GetPosition();
+      for( int N { 1 }; N <= 10; N++ ) FFile->WriteInt64( 0 );
+   }
    SetTextList = std::make_unique<TSetTextList>();
    SetTextList->OneBased = false;
    SetTextList->Add( "", 0 );
@@ -465,7 +518,7 @@ int TGXFileObj::gdxDataWriteStrStart( const char *SyId, const char *ExplTxt, int
    if( !PrepareSymbolWrite( "DataWriteStrStart"s, SyId, ExplTxt, Dim, Typ, UserInfo ) ) return false;
    for( int D {}; D < FCurrentDim; D++ )
       LastStrElem[D].front() = std::numeric_limits<char>::max();
-   SortList = std::make_unique<LinkedDataType>( FCurrentDim, DataSize * static_cast<int>( sizeof( double ) ) );
+   NewSortList();
    fmode = fw_dom_str;
    return true;
 }
@@ -518,12 +571,17 @@ int TGXFileObj::gdxDataWriteDone()
       TgdxValues AVals;
       while( ReadPtr && SortList->GetNextRecord( &*ReadPtr, AElements.data(), AVals.data() ) )
          DoWrite( AElements.data(), AVals.data() );
-      SortList = nullptr;
+      ReleaseSortList();
    }
    FFile->WriteByte( 255 );// end of data
    NextWritePosition = FFile->GetPosition();
    CurSyPtr->SDataCount = DataCount;// reflects dupes
    CurSyPtr->SErrors = ErrCnt;
+   if( StoreFingerprints )
+   {
+      CurSyPtr->SHasFingerprint = true;
+      CurSyPtr->SFingerprint = MixHash( FingerprintSum + static_cast<uint64_t>( DataCount ) );
+   }
    ErrCnt = 0;
    fmode = fw_init;
    FFile->SetCompression( false );
@@ -542,8 +600,25 @@ int TGXFileObj::gdxClose()
    if( fmode == fw_init )
    {
       fnConv = FFile->GetFileName();
+      if( VersionRead < VERSION )
+      {
+         bool Need64BitCounts {};
+         for( int N { 1 }; N <= NameList->Count() && !Need64BitCounts; N++ )
+         {
+            const auto PSy = *NameList->GetObject( N );
+            Need64BitCounts = PSy->SDataCount > std::numeric_limits<int>::max() || PSy->SErrors > std::numeric_limits<int>::max();
+         }
+         if( Need64BitCounts )
+         {
+            // header is never compressed: byte header number, string header id, integer version
+            VersionRead = VERSION;
+            FFile->SetPosition( 1 + 1 + static_cast<int64_t>( gdxHeaderId.length() ) );
+            FFile->WriteInteger( VersionRead );
+            FFile->SetPosition( NextWritePosition );
+         }
+      }
       FFile->SetCompression( CompressOut );
-      FFile->SetPosition( NextWritePosition );
+      if( !IndexInTrailer ) FFile->SetPosition( NextWritePosition );
       int64_t SymbPos = NextWritePosition;
       // write symbol table
       FFile->WriteString( MARK_SYMB );
@@ -556,10 +631,18 @@ int TGXFileObj::gdxClose()
          FFile->WriteInteger( PSy->SDim );
          FFile->WriteByte( PSy->SDataType );
          FFile->WriteInteger( PSy->SUserInfo );
-         FFile->WriteInteger( PSy->SDataCount );
-         FFile->WriteInteger( PSy->SErrors );
+         if( VersionRead >= 8 )
+         {
+            FFile->WriteInt64( PSy->SDataCount );
+            FFile->WriteInt64( PSy->SErrors );
+         }
+         else
+         {
+            FFile->WriteInteger( static_cast<int>( PSy->SDataCount ) );
+            FFile->WriteInteger( static_cast<int>( PSy->SErrors ) );
+         }
          FFile->WriteByte( PSy->SSetText );
-         FFile->WriteString<GMS_SSSIZE>( PSy->SExplTxt );
+         FFile->WriteString( SymbolArena.GetString( PSy->SExplTxt ) );
          FFile->WriteByte( PSy->SIsCompressed );
          FFile->WriteByte( PSy->SDomSymbols ? 1 : 0 );
 
@@ -567,11 +650,9 @@ int TGXFileObj::gdxClose()
             for( int D {}; D < PSy->SDim; D++ )
                FFile->WriteInteger( PSy->SDomSymbols[D] );
 
-         const int CommentCount { PSy->SCommentsList ? PSy->SCommentsList->size() : 0 };
-         FFile->WriteInteger( CommentCount );
-         if( CommentCount )
-            for( int Cnt {}; Cnt < CommentCount; Cnt++ )
-               FFile->WriteString( ( *PSy->SCommentsList )[Cnt] );
+         FFile->WriteInteger( static_cast<int>( PSy->SComments.size() ) );
+         for( const int64_t TxtOfs: PSy->SComments )
+            FFile->WriteString( SymbolArena.GetString( TxtOfs ) );
       }
       FFile->WriteString( MARK_SYMB );
 
@@ -619,13 +700,48 @@ int TGXFileObj::gdxClose()
       FFile->WriteInteger( -1 );
       FFile->WriteString( MARK_DOMS );
 
+      // write symbol fingerprints; the section is optional and older readers never look at its index slot
+      bool HasFingerprints {};
+      for( int N { 1 }; N <= NameList->Count() && !HasFingerprints; N++ )
+         HasFingerprints = ( *NameList->GetObject( N ) )->SHasFingerprint;
+      int64_t FingerprintPos {};
+      if( HasFingerprints )
+      {
+         FingerprintPos = FFile->GetPosition();
+         FFile->SetCompression( CompressOut );
+         FFile->WriteString( MARK_FPRT );
+         FFile->WriteInteger( NameList->Count() );
+         for( int N { 1 }; N <= NameList->Count(); N++ )
+         {
+            if( const auto *PSy = *( *NameList )[N];
+                PSy->SHasFingerprint )
+            {
+               FFile->WriteInteger( N );
+               FFile->WriteInt64( static_cast<int64_t>( PSy->SFingerprint ) );
+            }
+         }
+         FFile->WriteInteger( -1 );
+         FFile->WriteString( MARK_FPRT );
+      }
+
       // This must be at the very end!!!
-      FFile->SetPosition( MajorIndexPosition );
       FFile->SetCompression( false );
+      if( IndexInTrailer )
+      {
+         // The index is appended as trailer. After gdxOpenAppend the new tables can be shorter than
+         // the old ones, so pad up to the old trailer to keep the trailer at the very end of the file.
+         while( FFile->GetPosition() < MajorIndexPosition ) FFile->WriteByte( 0 );
+         MajorIndexPosition = FFile->GetPosition();
+      }
+      else
+         FFile->SetPosition( MajorIndexPosition );
       FFile->WriteInteger( MARK_BOI );
       // Note that we have room for 10 indices; if we need more, create an overflow link in the 10th position.
-      for( const int64_t offset: { SymbPos, UELPos, SetTextPos, AcronymPos, NextWritePosition, DomStrPos } )
+      for( const int64_t offset: { SymbPos, UELPos, SetTextPos, AcronymPos, NextWritePosition, DomStrPos, FingerprintPos } )
          FFile->WriteInt64( offset );
+      // The trailer has a fixed size, so a reader can find it relative to the end of the file
+      if( IndexInTrailer )
+         for( int N { 8 }; N <= 10; N++ ) FFile->WriteInt64( 0 );
    }
 
    int res { FFile ? FFile->GetLastIOResult() : 1 };
@@ -634,17 +750,16 @@ int TGXFileObj::gdxClose()
    if( NameList )
    {
       for( int N { 1 }; N <= NameList->Count(); N++ )
-      {
-         const auto PSy = *NameList->GetObject( N );
-         delete PSy;
-      }
+         TSymbolArena::FreeSymbol( *NameList->GetObject( N ) );
       NameList = nullptr;
+      SymbolArena.Clear();
    }
 
    FFile = nullptr;
    SetTextList = nullptr;
    UELTable = nullptr;
    SortList = nullptr;
+   SpareSortList = nullptr;
    DomainStrList = nullptr;
    ErrorList = nullptr;
    FilterList = nullptr;
@@ -653,6 +768,7 @@ int TGXFileObj::gdxClose()
 
    fmode = f_not_open;
    fstatus = stat_notopen;
+   UELsDeferred = AcronymsDeferred = false;
 
    if( AutoConvert && !fnConv.empty() )
    {
@@ -668,6 +784,11 @@ void TGXFileObj::InitErrors()
    LastError = LastRepError = ERR_NOERROR;
 }
 
+int gdxSetAllocator( gdlib::gmsalloc::TAllocProc AllocProc, gdlib::gmsalloc::TFreeProc FreeProc, void *Uptr )
+{
+   return gdlib::gmsalloc::SetAllocator( AllocProc, FreeProc, Uptr );
+}
+
 TGXFileObj::TGXFileObj( std::string &ErrMsg )
 {
    ErrMsg.clear();
@@ -732,7 +853,7 @@ bool TGXFileObj::PrepareSymbolWrite( const std::string_view Caller,
 {
    CurSyPtr = nullptr;
    ErrorList = nullptr;
-   SortList = nullptr;
+   ReleaseSortList();
 
    if( !MajorCheckMode( Caller, fw_init ) ) return false;
 
@@ -743,26 +864,26 @@ bool TGXFileObj::PrepareSymbolWrite( const std::string_view Caller,
 
    if( ErrorCondition( ADim >= 0 && ADim <= GLOBAL_MAX_INDEX_DIM, ERR_BADDIMENSION ) ||
        ErrorCondition( AType >= 0 && AType <= dt_equ, ERR_BADDATATYPE ) ) return false;
-   CurSyPtr = new TgdxSymbRecord {};
+   CurSyPtr = SymbolArena.NewSymbol();
    auto &obj = CurSyPtr;
    obj->SPosition = CurSyPtr->SDataCount = CurSyPtr->SErrors = 0;// Position
    obj->SDim = ADim;
    obj->SDataType = static_cast<gdxSyType>( AType );
    obj->SUserInfo = AUserInfo;
    obj->SSetText = false;
-   if( AText )
    {
-      assignExplanatoryText( AText, obj->SExplTxt.data() );
-      //assignViewToBuf( AText, obj->SExplTxt.data(), GMS_SSSIZE );
+      sstring ExplTxt;
+      if( AText ) assignExplanatoryText( AText, ExplTxt.data() );
+      else
+         ExplTxt.front() = '\0';
+      obj->SExplTxt = SymbolArena.AddString( ExplTxt.data(), MakeGoodExplText( ExplTxt.data() ) );
    }
-   else
-      obj->SExplTxt.front() = '\0';
-   MakeGoodExplText( obj->SExplTxt.data() );
    obj->SIsCompressed = CompressOut && ADim > 0;
-   obj->SCommentsList = std::nullopt;
    obj->SDomSymbols = nullptr;
    obj->SDomStrings = nullptr;
    obj->SSetBitMap = in( (gdxSyType) AType, dt_set, dt_alias ) && ADim == 1 && StoreDomainSets ? std::make_unique<TSetBitMap>() : nullptr;
+   FingerprintSum = 0;
+   FingerprintPrefix.front() = FnvOffsetBasis;
 
    CurSyPtr->SSyNr = NameList->AddObject( AName, std::strlen( AName ), CurSyPtr );// +1 for universe
    FCurrentDim = ADim;
@@ -876,16 +997,16 @@ bool TGXFileObj::CheckMode( const std::string_view Routine, const TgxModeSet &MS
    return false;
 }
 
-int TGXFileObj::PrepareSymbolRead( const std::string_view Caller, int SyNr, const int *ADomainNrs, TgxFileMode newmode )
+int64_t TGXFileObj::PrepareSymbolRead( const std::string_view Caller, int SyNr, const int *ADomainNrs, TgxFileMode newmode )
 {
    if( in( fmode, fr_str_data, fr_map_data, fr_mapr_data, fr_raw_data ) )
       gdxDataReadDone();// NOTE: Not covered by unit tests yet.
    NrMappedAdded = 0;
    ErrorList = nullptr;
    CurSyPtr = nullptr;
-   SortList = nullptr;
+   ReleaseSortList();
 
-   if( !MajorCheckMode( Caller, fr_init ) )
+   if( !MajorCheckMode( Caller, fr_init ) || !LoadDeferredSections() )
    {
       // NOTE: Not covered by unit tests yet.
       fmode = fr_init;
@@ -913,7 +1034,7 @@ int TGXFileObj::PrepareSymbolRead( const std::string_view Caller, int SyNr, cons
          }
       }
    }
-   int NrRecs;
+   int64_t NrRecs;
    if( ReadUniverse )
    {
       FCurrentDim = 1;
@@ -993,7 +1114,7 @@ int TGXFileObj::PrepareSymbolRead( const std::string_view Caller, int SyNr, cons
    }
    bool AllocOk { true };
 
-   int res { -1 };
+   int64_t res { -1 };
    if( in( newmode, fr_raw_data, fr_str_data, fr_slice ) )
       res = NrRecs;
    else
@@ -1009,7 +1130,7 @@ int TGXFileObj::PrepareSymbolRead( const std::string_view Caller, int SyNr, cons
          try
          {
             TIntegerMapping ExpndList;
-            SortList = std::make_unique<LinkedDataType>( FCurrentDim, static_cast<int>( DataSize * sizeof( double ) ) );
+            NewSortList();
             int FIDim = FCurrentDim;// First invalid dimension
             TgdxValues Avals;
             TIndex AElements {};
@@ -1132,7 +1253,7 @@ int TGXFileObj::PrepareSymbolRead( const std::string_view Caller, int SyNr, cons
                }
             }
             ReadPtr = SortList->StartRead( nullptr );
-            res = static_cast<int>( SortList->Count() );
+            res = SortList->Count();
          }
          catch( std::exception &e )
          {
@@ -1167,14 +1288,16 @@ void TGXFileObj::SetError( int N )
    ErrCntTotal++;
 }
 
-void TGXFileObj::InitDoWrite( int NrRecs )
+void TGXFileObj::InitDoWrite( int64_t NrRecs )
 {
    DataCount = 0;
-   FFile->SetPosition( NextWritePosition );
+   // append-only files are always positioned at NextWritePosition already
+   if( !IndexInTrailer ) FFile->SetPosition( NextWritePosition );
    CurSyPtr->SPosition = NextWritePosition;
    FFile->WriteString( MARK_DATA );
    FFile->WriteByte( static_cast<uint8_t>( FCurrentDim ) );
-   FFile->WriteInteger( NrRecs );// ignores dupes in count
+   // ignores dupes in count, only informative (skipped by readers) so we saturate instead of bumping the version
+   FFile->WriteInteger( RecordCount32( NrRecs ) );
    for( int D {}; D < FCurrentDim; D++ )
    {
       LastElem[D] = INDEX_INITIAL;
@@ -1321,6 +1444,9 @@ bool TGXFileObj::DoWrite( const int *AElements, const double *AVals )
          }
       }
    }
+   uint64_t RecordHash {};
+   if( StoreFingerprints )
+      RecordHash = FingerprintKeys( AElements, FDim - 1 );
    if( DataSize > 0 )
    {
       for( int DV {}; DV <= LastDataField; DV++ )
@@ -1356,6 +1482,8 @@ bool TGXFileObj::DoWrite( const int *AElements, const double *AVals )
             }
          }
          FFile->WriteByte( xv );
+         if( StoreFingerprints )
+            RecordHash = FingerprintValue( RecordHash, X, xv );
          if( xv == vm_normal )
          {
             FFile->WriteDouble( X );
@@ -1366,6 +1494,8 @@ bool TGXFileObj::DoWrite( const int *AElements, const double *AVals )
       if( verboseTrace && TraceLevel >= TraceLevels::trl_all )
          debugStream << "level="s << AVals[GMS_VAL_LEVEL] << '\n';// NOTE: Not covered by unit tests yet.
    }
+   if( StoreFingerprints )
+      FingerprintSum += MixHash( RecordHash );
    DataCount++;
    if( in( CurSyPtr->SDataType, dt_set, dt_alias ) )
    {
@@ -1379,6 +1509,42 @@ bool TGXFileObj::DoWrite( const int *AElements, const double *AVals )
    return true;
 }
 
+// Extend the hashed UEL strings of the previous record from the first changed dimension on and
+// return the hash of all keys of the current record
+uint64_t TGXFileObj::FingerprintKeys( const int *AElements, int FirstChanged )
+{
+   for( int D { FirstChanged }; D < FCurrentDim; D++ )
+   {
+      uint64_t H { FingerprintPrefix[D] };
+      if( const int N { AElements[D] }; N >= 1 && N <= UELTable->size() )
+      {
+         const char *S { ( *UELTable )[N] };
+         H = FnvAdd( H, S, std::strlen( S ) + 1 );
+      }
+      else
+      {
+         // NOTE: Not covered by unit tests yet.
+         constexpr uint8_t NoUEL { 255 };
+         H = FnvAdd( FnvAdd( H, &NoUEL, 1 ), &N, sizeof( N ) );
+      }
+      FingerprintPrefix[D + 1] = H;
+   }
+   return FingerprintPrefix[FCurrentDim];
+}
+
+uint64_t TGXFileObj::FingerprintValue( uint64_t H, double X, uint8_t xv ) const
+{
+   // set texts are hashed by their string, the text numbers depend on the order the texts were added
+   if( in( CurSyPtr->SDataType, dt_set, dt_alias ) && SetTextList && X >= 1 && X < SetTextList->size() && X == std::trunc( X ) )
+   {
+      constexpr uint8_t TextTag { 255 };
+      const char *S { SetTextList->GetName( static_cast<int>( X ) ) };
+      return FnvAdd( FnvAdd( H, &TextTag, 1 ), S, std::strlen( S ) + 1 );
+   }
+   H = FnvAdd( H, &xv, 1 );
+   return xv == vm_normal ? FnvAdd( H, &X, sizeof( X ) ) : H;
+}
+
 bool TGXFileObj::DoRead( double *AVals, int &AFDim )
 {
    const auto maybeRemap = [this]( double v ) {
@@ -1513,43 +1679,42 @@ double TGXFileObj::AcronymRemap( double V )
 
 void TGXFileObj::AddToErrorListDomErrs( const std::array<int, GLOBAL_MAX_INDEX_DIM> &AElements, const double *AVals )
 {
-   if( !ErrorList ) ErrorList = std::make_unique<TTblGamsDataImpl<double>>( FCurrentDim, (int) ( DataSize * sizeof( double ) ) );
-   else if( ErrorList->GetCount() >= 11 )
-      return;// NOTE: Not covered by unit tests yet.
-
-   static std::array<int, GLOBAL_MAX_INDEX_DIM> keys {};
-   static std::array<double, GMS_VAL_MAX> vals {};
+   if( !ErrorList ) ErrorList = std::make_unique<TErrorList>( FCurrentDim, DataSize, ErrorLimit );
 
+   // only store the record if it shows an unmapped element not seen in a stored record yet
    for( int D {}; D < FCurrentDim; D++ )
    {
-      if( const int EN { AElements[D] }; EN < 0 )
+      if( const int EN { AElements[D] }; EN < 0 && !ErrorList->HasNegKey( D, EN ) )
       {
-         bool Found {};
-         for( int i {}; i < ErrorList->GetCount(); i++ )
-         {
-            ErrorList->GetRecord( i, keys.data(), vals.data() );
-            if( keys[D] == EN )
-            {
-               // NOTE: Not covered by unit tests yet.
-               Found = true;
-               break;
-            }
-         }
-         if( !Found )
-         {
-            ErrorList->AddRecord( AElements.data(), AVals );
-            return;
-         }
+         ErrorList->AddRecord( AElements.data(), AVals );
+         return;
       }
    }
 }
 
+// Sort list for the current symbol, reusing the batches of the previous symbol if there was one
+void TGXFileObj::NewSortList()
+{
+   const int DataBytes { static_cast<int>( DataSize * sizeof( double ) ) };
+   if( SpareSortList )
+   {
+      SortList = std::move( SpareSortList );
+      SortList->Reset( FCurrentDim, DataBytes );
+   }
+   else
+      SortList = std::make_unique<LinkedDataType>( FCurrentDim, DataBytes );
+}
+
+void TGXFileObj::ReleaseSortList()
+{
+   if( !SortList ) return;
+   SortList->Clear();
+   SpareSortList = std::move( SortList );
+}
+
 void TGXFileObj::AddToErrorList( const int *AElements, const double *AVals )
 {
-   if( !ErrorList )
-      ErrorList = std::make_unique<TTblGamsDataImpl<double>>( FCurrentDim, (int) ( DataSize * sizeof( double ) ) );
-   else if( ErrorList->GetCount() >= 11 )// avoid storing too many errors
-      return;                            // NOTE: Not covered by unit tests yet.
+   if( !ErrorList ) ErrorList = std::make_unique<TErrorList>( FCurrentDim, DataSize, ErrorLimit );
    ErrorList->AddRecord( AElements, AVals );
 }
 
@@ -1776,7 +1941,7 @@ int TGXFileObj::gdxDataReadStr( char **KeyStr, double *Values, int &DimFrst )
 int TGXFileObj::gdxDataReadDone()
 {
    static const TgxModeSet AllowedMode { fr_init, fr_raw_data, fr_map_data, fr_mapr_data, fr_str_data, fr_slice };
-   SortList = nullptr;
+   ReleaseSortList();
    CurSyPtr = nullptr;
    if( !MajorCheckMode( "DataReadDone"s, AllowedMode ) )
    {
@@ -1838,6 +2003,14 @@ int TGXFileObj::gdxSymbolInfo( int SyNr, char *SyId, int &Dim, int &Typ )
 }
 
 int TGXFileObj::gdxDataReadStrStart( int SyNr, int &NrRecs )
+{
+   int64_t NrRecs64;
+   const int res { gdxDataReadStrStart64( SyNr, NrRecs64 ) };
+   NrRecs = RecordCount32( NrRecs64 );
+   return res;
+}
+
+int TGXFileObj::gdxDataReadStrStart64( int SyNr, int64_t &NrRecs )
 {
    auto XDomains { arrayWithValue<int, GLOBAL_MAX_INDEX_DIM>( DOMC_UNMAPPED ) };
    NrRecs = PrepareSymbolRead( "DataReadStrStart"s, SyNr, XDomains.data(), fr_str_data );
@@ -1850,6 +2023,106 @@ static inline std::string_view substr( const std::string_view s, int offset, int
    return ( s.empty() || offset > (int) s.size() - 1 ) ? std::string_view {} : s.substr( offset, len );
 }
 
+// Reads the UEL table and the set text table (skipped when SetTextPos is zero)
+bool TGXFileObj::ReadUELsAndSetTexts( int64_t UELPos, int64_t SetTextPos, int64_t AcronymPos )
+{
+   // reading UEL table
+   FFile->SetCompression( DoUncompress );
+   FFile->SetPosition( UELPos );
+
+   if( ErrorCondition( FFile->ReadString() == MARK_UEL, ERR_OPEN_UELMARKER1 ) )
+      return false;// NOTE: Not covered by unit tests yet.
+
+   int NrElem { FFile->ReadInteger() };
+   // subtract 2*6 bytes for MARK_UEL ("_UEL_\0") and 4 bytes for UEL count integer
+   const auto uelLabelStrBytes { VersionRead >= 7 ? AcronymPos-UELPos - 6 * 2 - 4 : 0 };
+   UELTable->SetCapacity( NrElem, uelLabelStrBytes );
+   // bug for pre 2002
+   if( substr( FileSystemID, 15, 4 ) == "2001"s ) NrElem--;
+
+   while( UELTable->size() < NrElem )
+   {
+      uint8_t slen;
+      sstring s;
+      FFile->ReadSString( s.data(), slen );
+      UELTable->StoreObject( s.data(), slen, -1 );
+   }
+   UelCntOrig = UELTable->size(); // needed when reading universe
+
+   if( ErrorCondition( FFile->ReadString() == MARK_UEL, ERR_OPEN_UELMARKER2 ) ) return false;
+
+   // reading set text table
+   if( SetTextPos )
+   {
+      FFile->SetCompression( DoUncompress );
+      FFile->SetPosition( SetTextPos );
+      SetTextList = std::make_unique<TSetTextList>();
+      SetTextList->OneBased = false;
+      if( ErrorCondition( FFile->ReadString() == MARK_SETT, ERR_OPEN_TEXTMARKER1 ) ) return false;
+      NrElem = FFile->ReadInteger();
+      // set text table (when there) is always before UEL table
+      // subtract bytes for length (4-byte) and twice 7 chars MARK_SETT (_SETT_\0)
+      const auto setTextStrBytes { UELPos - SetTextPos - 7 * 2 - 4 };
+      SetTextList->SetCapacity( NrElem, setTextStrBytes );
+      for( int N {}; N < NrElem; N++ )
+      {
+         uint8_t slen;
+         sstring s;
+         FFile->ReadSString( s.data(), slen );
+         if( const int TextNum { SetTextList->Add( s.data(), slen ) };
+            TextNum != N )
+         {// duplicates stored in GDX file, e.g. empty string
+            // NOTE: Not covered by unit tests yet.
+            if( !MapSetText )
+            {
+               MapSetText = std::make_unique<int[]>( NrElem );
+               for( int D {}; D < N; D++ )
+                  MapSetText[D] = D;
+            }
+            MapSetText[N] = TextNum;
+         }
+      }
+      if( ErrorCondition( FFile->ReadString() == MARK_SETT, ERR_OPEN_TEXTMARKER2 ) ) return false;
+   }
+   return true;
+}
+
+bool TGXFileObj::ReadAcronyms( int64_t AcronymPos )
+{
+   if( VersionRead >= 7 )
+   {
+      FFile->SetCompression( DoUncompress );
+      FFile->SetPosition( AcronymPos );
+      if( ErrorCondition( FFile->ReadString() == MARK_ACRO, ERR_OPEN_ACROMARKER1 ) ) return false;
+      AcronymList->LoadFromStream( *FFile );
+      if( ErrorCondition( FFile->ReadString() == MARK_ACRO, ERR_OPEN_ACROMARKER2 ) ) return false;
+   }
+   return true;
+}
+
+// Header-only opens (ReadMode bit 1) defer the UEL, set text and acronym sections until the first call
+// that needs them. This is logically const, so it can also be used by the const query methods.
+bool TGXFileObj::LoadDeferredSections() const
+{
+   if( !UELsDeferred ) return LoadDeferredAcronyms();
+   auto *self { const_cast<TGXFileObj *>( this ) };
+   self->UELsDeferred = false;
+   const bool res { self->ReadUELsAndSetTexts( DeferredUELPos, DeferredSetTextPos, DeferredAcronymPos ) };
+   FFile->SetCompression( false );
+   return res && LoadDeferredAcronyms();
+}
+
+// Listing acronyms should not pull in the (potentially huge) UEL table
+bool TGXFileObj::LoadDeferredAcronyms() const
+{
+   if( !AcronymsDeferred ) return true;
+   auto *self { const_cast<TGXFileObj *>( this ) };
+   self->AcronymsDeferred = false;
+   const bool res { self->ReadAcronyms( DeferredAcronymPos ) };
+   FFile->SetCompression( false );
+   return res;
+}
+
 int TGXFileObj::gdxOpenReadXX( const char *Afn, int filemode, int ReadMode, int &ErrNr )
 {
    if( fmode != f_not_open )
@@ -1873,6 +2146,7 @@ int TGXFileObj::gdxOpenReadXX( const char *Afn, int filemode, int ReadMode, int
    auto FileErrorNr = [&] {
       ErrNr = LastError;
       FFile = nullptr;
+      UELsDeferred = AcronymsDeferred = false;
       return false;
    };
 
@@ -1918,8 +2192,18 @@ int TGXFileObj::gdxOpenReadXX( const char *Afn, int filemode, int ReadMode, int
 
    // read section/segment offsets
    MajorIndexPosition = FFile->GetPosition();
-   if( ErrorCondition( FFile->ReadInteger() == MARK_BOI, ERR_OPEN_BOI ) ) return FileErrorNr();
-   int64_t AcronymPos {}, DomStrPos {}, SymbPos {}, UELPos {}, SetTextPos {};
+   int Mark { FFile->ReadInteger() };
+   IndexInTrailer = VersionRead >= 7 && Mark == MARK_EOI;
+   if( IndexInTrailer )
+   {
+      // append-only variant: the major index is the fixed-size trailer at the end of the file
+      MajorIndexPosition = FFile->GetSize() - MajorIndexSize;
+      if( ErrorCondition( MajorIndexPosition > 0, ERR_OPEN_BOI ) ) return FileErrorNr();
+      FFile->SetPosition( MajorIndexPosition );
+      Mark = FFile->ReadInteger();
+   }
+   if( ErrorCondition( Mark == MARK_BOI, ERR_OPEN_BOI ) ) return FileErrorNr();
+   int64_t AcronymPos {}, DomStrPos {}, SymbPos {}, UELPos {}, SetTextPos {}, FingerprintPos {};
 
    if( VersionRead <= 5 )
    {
@@ -1939,6 +2223,7 @@ int TGXFileObj::gdxOpenReadXX( const char *Afn, int filemode, int ReadMode, int
          AcronymPos = FFile->ReadInt64();
          NextWritePosition = FFile->ReadInt64();
          DomStrPos = FFile->ReadInt64();
+         FingerprintPos = FFile->ReadInt64();
       }
    }
    // reading symbol table
@@ -1949,6 +2234,8 @@ int TGXFileObj::gdxOpenReadXX( const char *Afn, int filemode, int ReadMode, int
    NameList = std::make_unique<TNameList>();
    NameList->OneBased = true;
    NameList->SetCapacity( NrElem );
+   SymbolArena.Clear();
+   SymbolArena.SetCapacity( NrElem );
    AcronymList = std::make_unique<TAcronymList>(true);
    FilterList = std::make_unique<TFilterList>();
    const int NrElemsOfSym = NrElem;
@@ -1957,39 +2244,37 @@ int TGXFileObj::gdxOpenReadXX( const char *Afn, int filemode, int ReadMode, int
       uint8_t Slen;
       sstring S;
       FFile->ReadSString(S.data(), Slen);
-      CurSyPtr = new TgdxSymbRecord {};
+      CurSyPtr = SymbolArena.NewSymbol();
       CurSyPtr->SPosition = VersionRead <= 5 ? FFile->ReadInteger() : FFile->ReadInt64();
       CurSyPtr->SDim = FFile->ReadInteger();
       uint8_t B { FFile->ReadByte() };
       CurSyPtr->SDataType = static_cast<gdxSyType>( B );
       CurSyPtr->SUserInfo = FFile->ReadInteger();
-      CurSyPtr->SDataCount = FFile->ReadInteger();
-      CurSyPtr->SErrors = FFile->ReadInteger();
+      CurSyPtr->SDataCount = VersionRead >= 8 ? FFile->ReadInt64() : FFile->ReadInteger();
+      CurSyPtr->SErrors = VersionRead >= 8 ? FFile->ReadInt64() : FFile->ReadInteger();
       B = FFile->ReadByte();
       CurSyPtr->SSetText = B;
-      assignStrToBuf( FFile->ReadString(), CurSyPtr->SExplTxt.data(), GMS_SSSIZE );
+      sstring ExplTxt;
+      uint8_t ExplTxtLen;
+      FFile->ReadSString( ExplTxt.data(), ExplTxtLen );
+      CurSyPtr->SExplTxt = SymbolArena.AddString( ExplTxt.data(), ExplTxtLen );
       CurSyPtr->SIsCompressed = VersionRead > 5 && FFile->ReadByte();
       CurSyPtr->SDomSymbols = nullptr;
-      CurSyPtr->SCommentsList = std::nullopt;
       if( VersionRead >= 7 )
       {
          if( FFile->ReadByte() )
          {
-            CurSyPtr->SDomSymbols = std::make_unique<int[]>( CurSyPtr->SDim );
+            CurSyPtr->SDomSymbols = SymbolArena.NewIntArray( CurSyPtr->SDim );
             for( int D {}; D < CurSyPtr->SDim; D++ )
                CurSyPtr->SDomSymbols[D] = FFile->ReadInteger();
          }
          NrElem = FFile->ReadInteger();
-         if( NrElem > 0 )
+         for( ; NrElem > 0; NrElem-- )
          {
-            CurSyPtr->SCommentsList = std::make_optional<TCommentsList>();
-            for( ; NrElem > 0; NrElem-- )
-            {
-               sstring s;
-               uint8_t slen;
-               FFile->ReadSString( s.data(), slen );
-               CurSyPtr->SCommentsList->Add( s.data(), slen );
-            }
+            sstring s;
+            uint8_t slen;
+            FFile->ReadSString( s.data(), slen );
+            SymbolArena.AddComment( *CurSyPtr, s.data(), slen );
          }
       }
       CurSyPtr->SSetBitMap = nullptr;
@@ -1998,75 +2283,23 @@ int TGXFileObj::gdxOpenReadXX( const char *Afn, int filemode, int ReadMode, int
    }
    if( ErrorCondition( FFile->ReadString() == MARK_SYMB, ERR_OPEN_SYMBOLMARKER2 ) ) return FileErrorNr();
 
-   // reading UEL table
-   FFile->SetCompression( DoUncompress );
-   FFile->SetPosition( UELPos );
    UELTable = std::make_unique<UELTableImplChoice>();
-
-   if( ErrorCondition( FFile->ReadString() == MARK_UEL, ERR_OPEN_UELMARKER1 ) )
-      return FileErrorNr();// NOTE: Not covered by unit tests yet.
-
-   NrElem = FFile->ReadInteger();
-   // subtract 2*6 bytes for MARK_UEL ("_UEL_\0") and 4 bytes for UEL count integer
-   const auto uelLabelStrBytes { VersionRead >= 7 ? AcronymPos-UELPos - 6 * 2 - 4 : 0 };
-   UELTable->SetCapacity( NrElem, uelLabelStrBytes );
-   // bug for pre 2002
-   if( substr( FileSystemID, 15, 4 ) == "2001"s ) NrElem--;
-
-   while( UELTable->size() < NrElem )
-   {
-      uint8_t slen;
-      sstring s;
-      FFile->ReadSString( s.data(), slen );
-      UELTable->StoreObject( s.data(), slen, -1 );
-   }
-   UelCntOrig = UELTable->size(); // needed when reading universe
-
-   if( ErrorCondition( FFile->ReadString() == MARK_UEL, ERR_OPEN_UELMARKER2 ) ) return FileErrorNr();
-
-   // reading set text table
-   if( ReadMode % 2 == 0 )
-   {
-      FFile->SetCompression( DoUncompress );
-      FFile->SetPosition( SetTextPos );
-      SetTextList = std::make_unique<TSetTextList>();
-      SetTextList->OneBased = false;
-      if( ErrorCondition( FFile->ReadString() == MARK_SETT, ERR_OPEN_TEXTMARKER1 ) ) return FileErrorNr();
-      NrElem = FFile->ReadInteger();
-      // set text table (when there) is always before UEL table
-      // subtract bytes for length (4-byte) and twice 7 chars MARK_SETT (_SETT_\0)
-      const auto setTextStrBytes { UELPos - SetTextPos - 7 * 2 - 4 };
-      SetTextList->SetCapacity( NrElem, setTextStrBytes );
-      for( int N {}; N < NrElem; N++ )
-      {
-         uint8_t slen;
-         sstring s;
-         FFile->ReadSString( s.data(), slen );
-         if( const int TextNum { SetTextList->Add( s.data(), slen ) };
-            TextNum != N )
-         {// duplicates stored in GDX file, e.g. empty string
-            // NOTE: Not covered by unit tests yet.
-            if( !MapSetText )
-            {
-               MapSetText = std::make_unique<int[]>( NrElem );
-               for( int D {}; D < N; D++ )
-                  MapSetText[D] = D;
-            }
-            MapSetText[N] = TextNum;
-         }
-      }
-      if( ErrorCondition( FFile->ReadString() == MARK_SETT, ERR_OPEN_TEXTMARKER2 ) ) return FileErrorNr();
-   }
-
-   // reading acronym list
-   if( VersionRead >= 7 )
+   UELsDeferred = AcronymsDeferred = ReadMode & 2;
+   if( UELsDeferred )
    {
+      // header only: just peek at the UEL count, the sections are read on first use
+      DeferredUELPos = UELPos;
+      DeferredSetTextPos = ReadMode % 2 == 0 ? SetTextPos : 0;
+      DeferredAcronymPos = AcronymPos;
       FFile->SetCompression( DoUncompress );
-      FFile->SetPosition( AcronymPos );
-      if( ErrorCondition( FFile->ReadString() == MARK_ACRO, ERR_OPEN_ACROMARKER1 ) ) return FileErrorNr();
-      AcronymList->LoadFromStream( *FFile );
-      if( ErrorCondition( FFile->ReadString() == MARK_ACRO, ERR_OPEN_ACROMARKER2 ) ) return FileErrorNr();
+      FFile->SetPosition( UELPos );
+      if( ErrorCondition( FFile->ReadString() == MARK_UEL, ERR_OPEN_UELMARKER1 ) ) return FileErrorNr();
+      DeferredUelCnt = FFile->ReadInteger();
+      if( substr( FileSystemID, 15, 4 ) == "2001"s ) DeferredUelCnt--;
    }
+   else if( !ReadUELsAndSetTexts( UELPos, ReadMode % 2 == 0 ? SetTextPos : 0, AcronymPos ) ||
+            !ReadAcronyms( AcronymPos ) )
+      return FileErrorNr();
 
    // reading domain strings list
    DomainStrList = std::make_unique<TDomainStrList>();
@@ -2083,13 +2316,31 @@ int TGXFileObj::gdxOpenReadXX( const char *Afn, int filemode, int ReadMode, int
          const int SyNr = FFile->ReadInteger();
          if( SyNr <= 0 ) break;
          const auto sym = *NameList->GetObject( SyNr );
-         sym->SDomStrings = std::make_unique<int[]>( sym->SDim );
+         sym->SDomStrings = SymbolArena.NewIntArray( sym->SDim );
          for( int D {}; D < sym->SDim; D++ )
             sym->SDomStrings[D] = FFile->ReadInteger();
       }
       if( ErrorCondition( FFile->ReadString() == MARK_DOMS, ERR_OPEN_DOMSMARKER3 ) ) return FileErrorNr();
    }
 
+   // reading symbol fingerprints; a section written for a different symbol table is ignored
+   SymbolTablePos = SymbPos;
+   DataPositions.clear();
+   if( VersionRead >= 7 && FingerprintPos > 0 && FingerprintPos < FFile->GetSize() )
+   {
+      FFile->SetCompression( DoUncompress );
+      FFile->SetPosition( FingerprintPos );
+      if( FFile->ReadString() == MARK_FPRT && FFile->ReadInteger() == NameList->Count() )
+      {
+         for( int SyNr { FFile->ReadInteger() }; SyNr >= 1 && SyNr <= NameList->Count(); SyNr = FFile->ReadInteger() )
+         {
+            const auto sym = *NameList->GetObject( SyNr );
+            sym->SHasFingerprint = true;
+            sym->SFingerprint = static_cast<uint64_t>( FFile->ReadInt64() );
+         }
+      }
+   }
+
    LastError = ERR_NOERROR;
    gdxResetSpecialValues();
    fmode = fr_init;
@@ -2120,19 +2371,20 @@ int TGXFileObj::gdxAddAlias( const char *Id1, const char *Id2 )
    else if( ErrorCondition( in( ( *NameList->GetObject( SyNr ) )->SDataType, dt_set, dt_alias ), ERR_ALIASSETEXPECTED ) )
       return false;// NOTE: Not covered by unit tests yet.
    if( !IsGoodNewSymbol( AName ) ) return false;
-   auto SyPtr = new TgdxSymbRecord {};
+   auto SyPtr = SymbolArena.NewSymbol();
    // NOTE: SSyNr not set correctly for alias! (was also like this in original P3 implementation of GDX)
    SyPtr->SDataType = dt_alias;
    SyPtr->SUserInfo = SyNr;
    if( !SyNr )
    {
       SyPtr->SDim = 1;
-      assignStrToBuf( "Aliased with *"s, SyPtr->SExplTxt.data() );
+      SyPtr->SExplTxt = SymbolArena.AddString( "Aliased with *", 14 );
    }
    else
    {
       SyPtr->SDim = ( *NameList->GetObject( SyNr ) )->SDim;
-      assignStrToBuf( "Aliased with "s + NameList->GetString( SyNr ), SyPtr->SExplTxt.data() );
+      const std::string ExplTxt { ( "Aliased with "s + NameList->GetString( SyNr ) ).substr( 0, GMS_SSSIZE - 1 ) };
+      SyPtr->SExplTxt = SymbolArena.AddString( ExplTxt.c_str(), ExplTxt.length() );
    }
    NameList->AddObject( AName, std::strlen( AName ), SyPtr );
    return true;
@@ -2140,7 +2392,7 @@ int TGXFileObj::gdxAddAlias( const char *Id1, const char *Id2 )
 
 int TGXFileObj::gdxAddSetText( const char *Txt, int &TxtNr )
 {
-   if( !SetTextList || ( TraceLevel >= TraceLevels::trl_all && !CheckMode( "AddSetText"s ) ) )
+   if( !LoadDeferredSections() || !SetTextList || ( TraceLevel >= TraceLevels::trl_all && !CheckMode( "AddSetText"s ) ) )
    {
       TxtNr = 0;
       return false;
@@ -2154,7 +2406,7 @@ int TGXFileObj::gdxAddSetText( const char *Txt, int &TxtNr )
 
 int TGXFileObj::gdxDataErrorCount() const
 {
-   return !ErrorList ? 0 : ErrorList->GetCount();
+   return !ErrorList ? 0 : static_cast<int>( std::min<int64_t>( ErrorList->GetCount(), std::numeric_limits<int>::max() ) );
 }
 
 int TGXFileObj::gdxDataErrorRecord( int RecNr, int *KeyInt, double *Values )
@@ -2190,6 +2442,25 @@ int TGXFileObj::gdxDataErrorRecordX( int RecNr, int *KeyInt, double *Values )
    return false;// NOTE: Not covered by unit tests yet.
 }
 
+int TGXFileObj::gdxDataErrorOverflowCount() const
+{
+   return !ErrorList ? 0 : static_cast<int>( std::min<int64_t>( ErrorList->OverflowCount(), std::numeric_limits<int>::max() ) );
+}
+
+int TGXFileObj::gdxDataErrorRecords( int RecNr, int Cnt, int *KeyInt, double *Values )
+{
+   static const TgxModeSet AllowedModes { fr_init, fw_init, fr_map_data, fr_mapr_data, fw_raw_data, fw_map_data, fw_str_data };
+   if( ( TraceLevel >= TraceLevels::trl_all || !in( fmode, AllowedModes ) ) && !CheckMode( "DataErrorRecords", AllowedModes ) )
+      return 0;
+   if( !ErrorList || Cnt <= 0 ) return 0;
+   if( RecNr < 1 || RecNr > ErrorList->GetCount() )
+   {
+      ReportError( ERR_BADERRORRECORD );
+      return 0;
+   }
+   return static_cast<int>( ErrorList->GetRecords( RecNr - 1, Cnt, KeyInt, Values, GMS_VAL_MAX ) );
+}
+
 int TGXFileObj::gdxDataReadRaw( int *KeyInt, double *Values, int &DimFrst )
 {
    if( ( TraceLevel >= TraceLevels::trl_all || fmode != fr_raw_data ) && !CheckMode( "DataReadRaw"s, fr_raw_data ) ) return false;
@@ -2212,6 +2483,14 @@ int TGXFileObj::gdxDataReadRaw( int *KeyInt, double *Values, int &DimFrst )
 }
 
 int TGXFileObj::gdxDataReadRawStart( int SyNr, int &NrRecs )
+{
+   int64_t NrRecs64;
+   const int res { gdxDataReadRawStart64( SyNr, NrRecs64 ) };
+   NrRecs = RecordCount32( NrRecs64 );
+   return res;
+}
+
+int TGXFileObj::gdxDataReadRawStart64( int SyNr, int64_t &NrRecs )
 {
    auto XDomains { arrayWithValue<int, GLOBAL_MAX_INDEX_DIM>( DOMC_UNMAPPED ) };
    NrRecs = PrepareSymbolRead( "DataReadRawStart"s, SyNr, XDomains.data(), fr_raw_data );
@@ -2258,7 +2537,7 @@ int TGXFileObj::gdxErrorCount() const
 int TGXFileObj::gdxGetElemText( int TxtNr, char *Txt, int &Node )
 {
    Node = 0;
-   if( !SetTextList )
+   if( !LoadDeferredSections() || !SetTextList )
    {
       Txt[0] = '\0';
       return false;
@@ -2434,10 +2713,18 @@ int TGXFileObj::gdxSymbolDim( int SyNr )
 }
 
 int TGXFileObj::gdxSymbolInfoX( int SyNr, int &RecCnt, int &UserInfo, char *ExplTxt )
+{
+   int64_t RecCnt64;
+   const int res { gdxSymbolInfoX64( SyNr, RecCnt64, UserInfo, ExplTxt ) };
+   RecCnt = RecordCount32( RecCnt64 );
+   return res;
+}
+
+int TGXFileObj::gdxSymbolInfoX64( int SyNr, int64_t &RecCnt, int &UserInfo, char *ExplTxt )
 {
    if( !SyNr )
    {
-      RecCnt = UelCntOrig;
+      RecCnt = UELsDeferred ? DeferredUelCnt : UelCntOrig;
       UserInfo = 0;
       assignPCharToBuf( "Universe", ExplTxt, GMS_SSSIZE );
       return true;
@@ -2451,10 +2738,64 @@ int TGXFileObj::gdxSymbolInfoX( int SyNr, int &RecCnt, int &UserInfo, char *Expl
    const auto *obj = ( *NameList->GetObject( SyNr ) );
    RecCnt = !obj->SDim ? 1 : obj->SDataCount;// scalar trick
    UserInfo = obj->SUserInfo;
-   assignPCharToBuf( obj->SExplTxt.data(), ExplTxt, GMS_SSSIZE );
+   assignPCharToBuf( SymbolArena.GetString( obj->SExplTxt ), ExplTxt, GMS_SSSIZE );
    return true;
 }
 
+// The symbol whose records are read for SyNr: aliases are followed to the aliased set,
+// nullptr for the universe or a bad symbol number
+const TgdxSymbRecord *TGXFileObj::SymbolWithData( int SyNr ) const
+{
+   if( !NameList || SyNr < 1 || SyNr > NameList->size() ) return nullptr;
+   const TgdxSymbRecord *sym { *NameList->GetObject( SyNr ) };
+   while( sym->SDataType == dt_alias )
+   {
+      SyNr = sym->SUserInfo;
+      if( SyNr < 1 || SyNr > NameList->size() ) return nullptr;
+      sym = *NameList->GetObject( SyNr );
+   }
+   return sym;
+}
+
+int TGXFileObj::gdxSymbolFingerprint( int SyNr, char *Fingerprint )
+{
+   const TgdxSymbRecord *sym { SymbolWithData( SyNr ) };
+   if( !sym || !sym->SHasFingerprint )
+   {
+      Fingerprint[0] = '\0';
+      return false;
+   }
+   assignPCharToBuf( HashToHex( sym->SFingerprint ).c_str(), Fingerprint, GMS_SSSIZE );
+   return true;
+}
+
+int TGXFileObj::gdxSymbolDataBytes( int SyNr, int64_t Offset, int Count, void *Buffer )
+{
+   // moving the file position would break a read in progress, so leave ending it to the caller
+   if( !MajorCheckMode( "SymbolDataBytes"s, fr_init ) ) return -1;
+   const TgdxSymbRecord *sym { SymbolWithData( SyNr ) };
+   if( !sym || !sym->SPosition || Offset < 0 || Count < 0 ) return -1;
+
+   // the data of a symbol ends where the data of the next symbol in the file starts
+   if( DataPositions.empty() )
+   {
+      DataPositions.reserve( NameList->size() );
+      for( int N { 1 }; N <= NameList->size(); N++ )
+         if( const int64_t Pos { ( *NameList->GetObject( N ) )->SPosition }; Pos > 0 )
+            DataPositions.push_back( Pos );
+      std::sort( DataPositions.begin(), DataPositions.end() );
+   }
+   const auto Next { std::upper_bound( DataPositions.begin(), DataPositions.end(), sym->SPosition ) };
+   const int64_t EndPos { Next != DataPositions.end() ? *Next : std::max( NextWritePosition, SymbolTablePos ) };
+   if( Offset >= EndPos - sym->SPosition ) return 0;
+
+   const auto N { static_cast<uint32_t>( std::min<int64_t>( Count, EndPos - sym->SPosition - Offset ) ) };
+   FFile->SetCompression( false );
+   FFile->SetPosition( sym->SPosition + Offset );
+   if( FFile->Read( Buffer, N ) != N ) return -1;// NOTE: Not covered by unit tests yet.
+   return static_cast<int>( N );
+}
+
 int TGXFileObj::gdxSymbolSetDomain( const char **DomainIDs )
 {
    static const TgxModeSet AllowedModes { fw_dom_raw, fw_dom_map, fw_dom_str };
@@ -2470,7 +2811,7 @@ int TGXFileObj::gdxSymbolSetDomain( const char **DomainIDs )
 
    int res { true };
    assert( !CurSyPtr->SDomSymbols && "SymbolSetDomain" );
-   CurSyPtr->SDomSymbols = std::make_unique<int[]>( CurSyPtr->SDim );
+   CurSyPtr->SDomSymbols = SymbolArena.NewIntArray( CurSyPtr->SDim );
    for( int D {}; D < CurSyPtr->SDim; D++ )
    {
       bool domap { true };
@@ -2563,7 +2904,7 @@ int TGXFileObj::gdxSymbolSetDomainX( int SyNr, const char **DomainIDs )
    if( SyPtr->SDim > 0 )
    {
       if( !SyPtr->SDomStrings )
-         SyPtr->SDomStrings = std::make_unique<int[]>( SyPtr->SDim );
+         SyPtr->SDomStrings = SymbolArena.NewIntArray( SyPtr->SDim );
       for( int D {}; D < SyPtr->SDim; D++ )
       {
          if( const char *S { DomainIDs[D] };
@@ -2585,7 +2926,7 @@ int TGXFileObj::gdxSymbolSetDomainX( int SyNr, const char **DomainIDs )
 
 int TGXFileObj::gdxSystemInfo( int &SyCnt, int &UelCnt ) const
 {
-   UelCnt = UELTable ? (int) UELTable->size() : 0;
+   UelCnt = UELsDeferred ? DeferredUelCnt : UELTable ? (int) UELTable->size() : 0;
    SyCnt = NameList ? (int) NameList->size() : 0;
    return true;
 }
@@ -2638,7 +2979,7 @@ int TGXFileObj::gdxUELRegisterStr( const char *Uel, int &UelNr )
 int TGXFileObj::gdxUELRegisterStrStart()
 {
    static const TgxModeSet AllowedModes { fr_init, fw_init };
-   if( !MajorCheckMode( "UELRegisterStrStart"s, AllowedModes ) ) return false;
+   if( !MajorCheckMode( "UELRegisterStrStart"s, AllowedModes ) || !LoadDeferredSections() ) return false;
    fmode_AftReg = fmode == fw_init ? fw_init : fr_init;
    fmode = f_str_elem;
    return true;
@@ -2646,7 +2987,7 @@ int TGXFileObj::gdxUELRegisterStrStart()
 
 int TGXFileObj::gdxUMUelGet( int UelNr, char *Uel, int &UelMap )
 {
-   if( UELTable && UelNr >= 1 && UelNr <= UELTable->size() )
+   if( UELTable && LoadDeferredSections() && UelNr >= 1 && UelNr <= UELTable->size() )
    {
       assignPCharToBuf( ( *UELTable )[UelNr], Uel );
       UelMap = UELTable->GetUserMap( UelNr );
@@ -2659,7 +3000,7 @@ int TGXFileObj::gdxUMUelGet( int UelNr, char *Uel, int &UelMap )
 
 int TGXFileObj::gdxUMUelInfo( int &UelCnt, int &HighMap ) const
 {
-   if( !FFile )
+   if( !FFile || !LoadDeferredSections() )
    {// AS: Use FFile != nullptr as proxy for checking open has been called before
       UelCnt = HighMap = 0;
       return false;
@@ -2676,7 +3017,7 @@ int TGXFileObj::gdxCurrentDim() const
 
 int TGXFileObj::gdxRenameUEL( const char *OldName, const char *NewName )
 {
-   if( !UELTable )
+   if( !UELTable || !LoadDeferredSections() )
       return -1;
 
    int slen;
@@ -2694,6 +3035,9 @@ int TGXFileObj::gdxRenameUEL( const char *OldName, const char *NewName )
    if( UELTable->IndexOf( S ) >= 0 )
       return 3;
    UELTable->RenameEntry( N, S );
+   // fingerprints were computed over the old label
+   for( int SyNr { 1 }; NameList && SyNr <= NameList->Count(); SyNr++ )
+      ( *NameList->GetObject( SyNr ) )->SHasFingerprint = false;
    return 0;
 }
 
@@ -2704,7 +3048,7 @@ int TGXFileObj::gdxOpenReadEx( const char *FileName, int ReadMode, int &ErrNr )
 
 int TGXFileObj::gdxGetUEL( int uelNr, char *Uel ) const
 {
-   if( !UELTable )
+   if( !UELTable || !LoadDeferredSections() )
    {
       Uel[0] = '\0';
       return false;
@@ -2719,7 +3063,7 @@ int TGXFileObj::gdxGetUEL( int uelNr, char *Uel ) const
 int TGXFileObj::gdxDataWriteMapStart( const char *SyId, const char *ExplTxt, int Dimen, int Typ, int UserInfo )
 {
    if( !PrepareSymbolWrite( "DataWriteMapStart"s, SyId, ExplTxt, Dimen, Typ, UserInfo ) ) return false;
-   SortList = std::make_unique<LinkedDataType>( FCurrentDim, static_cast<int>( DataSize * sizeof( double ) ) );
+   NewSortList();
    fmode = fw_dom_map;
    return true;
 }
@@ -2760,7 +3104,7 @@ int TGXFileObj::gdxDataWriteMap( const int *KeyInt, const double *Values )
 int TGXFileObj::gdxUELRegisterMapStart()
 {
    static const TgxModeSet AllowedModes { fr_init, fw_init };
-   if( !MajorCheckMode( "UELRegisterMapStart"s, AllowedModes ) )
+   if( !MajorCheckMode( "UELRegisterMapStart"s, AllowedModes ) || !LoadDeferredSections() )
       return false;
    fmode_AftReg = fmode == fw_init ? fw_init : fr_init;
    fmode = f_map_elem;
@@ -2786,6 +3130,14 @@ int TGXFileObj::gdxUELRegisterMap( int UMap, const char *Uel )
 }
 
 int TGXFileObj::gdxDataReadMapStart( int SyNr, int &NrRecs )
+{
+   int64_t NrRecs64;
+   const int res { gdxDataReadMapStart64( SyNr, NrRecs64 ) };
+   NrRecs = RecordCount32( NrRecs64 );
+   return res;
+}
+
+int TGXFileObj::gdxDataReadMapStart64( int SyNr, int64_t &NrRecs )
 {
    const auto XDomains = arrayWithValue<int, GLOBAL_MAX_INDEX_DIM>( DOMC_STRICT );
    NrRecs = PrepareSymbolRead( "DataReadMapStart"s, SyNr, XDomains.data(), fr_map_data );
@@ -2964,12 +3316,12 @@ void TGXFileObj::SetTraceLevel( TraceLevels tl )
 
 int TGXFileObj::gdxAcronymCount() const
 {
-   return !AcronymList ? 0 : static_cast<int>( AcronymList->size() );
+   return !AcronymList || !LoadDeferredAcronyms() ? 0 : static_cast<int>( AcronymList->size() );
 }
 
 int TGXFileObj::gdxAcronymGetInfo( int N, char *AName, char *Txt, int &AIndx ) const
 {
-   if( N < 1 || N > AcronymList->size() )
+   if( !LoadDeferredAcronyms() || N < 1 || N > AcronymList->size() )
    {
       AName[0] = Txt[0] = '\0';
       AIndx = 0;
@@ -2991,6 +3343,7 @@ int TGXFileObj::gdxAcronymSetInfo( int N, const char *AName, const char *Txt, in
       return true;
    };
 
+   if( !LoadDeferredAcronyms() ) return false;
    if( TraceLevel >= TraceLevels::trl_some )
       WriteTrace( "AcronymSetInfo: "s + AName + " index = " + rtl::sysutils_p3::IntToStr( AIndx ) ); // NOTE: Not covered by unit tests yet.
 
@@ -3008,7 +3361,7 @@ int TGXFileObj::gdxAcronymSetInfo( int N, const char *AName, const char *Txt, in
       else if( ErrorCondition( AIndx == obj.AcrMap, ERR_BADACROINDEX ) )
          return false; // NOTE: Not covered by unit tests yet.
 
-      obj.SetNameAndText( AName, Txt );
+      AcronymList->SetNameAndText( N - 1, AName, Txt );
    }
    else if( obj.AcrReadMap != AIndx )
    {
@@ -3030,6 +3383,7 @@ int TGXFileObj::gdxAcronymGetMapping( int N, int &orgIndx, int &newIndx, int &au
 {
    if( TraceLevel >= TraceLevels::trl_some )
       WriteTrace( "AcronymGetMapping: N = "s + rtl::sysutils_p3::IntToStr( N ) ); // NOTE: Not covered by unit tests yet.
+   if( !LoadDeferredAcronyms() ) return false;
    if( ErrorCondition( N >= 1 || N <= (int) AcronymList->size(), ERR_BADACRONUMBER ) ) return false;
    const auto &obj = ( *AcronymList )[N - 1];
    orgIndx = obj.AcrMap;
@@ -3046,7 +3400,7 @@ int TGXFileObj::gdxFilterExists( int FilterNr )
 
 int TGXFileObj::gdxFilterRegisterStart( int FilterNr )
 {
-   if( !MajorCheckMode( "FilterRegisterStart"s, fr_init ) ||
+   if( !MajorCheckMode( "FilterRegisterStart"s, fr_init ) || !LoadDeferredSections() ||
        ErrorCondition( FilterNr >= 1, ERR_BAD_FILTER_NR ) ) return false;
    CurFilter = new TDFilter { FilterNr, UELTable->UsrUel2Ent->GetHighestIndex() };
    FilterList->AddFilter( CurFilter );
@@ -3098,13 +3452,13 @@ int TGXFileObj::gdxFilterRegisterDone()
 
 int TGXFileObj::gdxDataReadFilteredStart( int SyNr, const int *FilterAction, int &NrRecs )
 {
-   NrRecs = PrepareSymbolRead( "DataReadStartFiltered"s, SyNr, FilterAction, fr_map_data );
+   NrRecs = RecordCount32( PrepareSymbolRead( "DataReadStartFiltered"s, SyNr, FilterAction, fr_map_data ) );
    return NrRecs >= 0;
 }
 
 int TGXFileObj::gdxSetTextNodeNr( int TxtNr, int Node )
 {
-   if( !SetTextList || ( TraceLevel >= TraceLevels::trl_all && !CheckMode( "SetTextNodeNr" ) ) ) return false;
+   if( !LoadDeferredSections() || !SetTextList || ( TraceLevel >= TraceLevels::trl_all && !CheckMode( "SetTextNodeNr" ) ) ) return false;
    auto &obj = *SetTextList;
    if( TxtNr >= 0 && TxtNr < obj.size() && !*obj.GetObject( TxtNr ) )
    {
@@ -3117,6 +3471,7 @@ int TGXFileObj::gdxSetTextNodeNr( int TxtNr, int Node )
 int TGXFileObj::gdxGetDomainElements( int SyNr, int DimPos, int FilterNr, TDomainIndexProc_t DP, int &NrElem, void *UPtr )
 {
    gdxGetDomainElements_DP = DP;
+   if( !LoadDeferredSections() ) return false;
    if( ErrorCondition( SyNr >= 1 && SyNr <= NameList->size(), ERR_BADSYMBOLINDEX ) ) return false;
    int Dim { ( *NameList->GetObject( SyNr ) )->SDim };
    if( !Dim || ErrorCondition( DimPos >= 1 && DimPos <= Dim, ERR_BADDIMENSION ) ) return false;
@@ -3161,21 +3516,17 @@ int TGXFileObj::gdxGetDomainElements( int SyNr, int DimPos, int FilterNr, TDomai
    TIndex Index {};
    if( !DP )
    {// we only count
-      for( int N { 1 }; N <= DomainIndxs.GetHighestIndex(); N++ )
-         if( DomainIndxs.GetMapping( N ) == 1 )
-            NrElem++;
+      for( int N { DomainIndxs.NextMapped( 1 ) }; N >= 0; N = DomainIndxs.NextMapped( N + 1 ) )
+         NrElem++;
    }
    else
    {//should we have an option to return indices in Raw order or in Mapped order?
       TTblGamsDataImpl<int> SortL { 1, sizeof( int ) };
-      for( int N { 1 }; N <= DomainIndxs.GetHighestIndex(); N++ )
+      for( int N { DomainIndxs.NextMapped( 1 ) }; N >= 0; N = DomainIndxs.NextMapped( N + 1 ) )
       {
-         if( DomainIndxs.GetMapping( N ) == 1 )
-         {
-            NrElem++;
-            Index.front() = UELTable->NewUsrUel( N );
-            SortL.AddRecord( Index.data(), &N );
-         }
+         NrElem++;
+         Index.front() = UELTable->NewUsrUel( N );
+         SortL.AddRecord( Index.data(), &N );
       }
       SortL.Sort();
       int RawNr;
@@ -3220,16 +3571,15 @@ int TGXFileObj::gdxSetTraceLevel( int N, const char *s )
 
 int TGXFileObj::gdxAcronymAdd( const char *AName, const char *Txt, int AIndx )
 {
-   for( int N {}; N < (int) AcronymList->size(); N++ )
+   if( !LoadDeferredAcronyms() ) return -1;
+   // an entry with this index must not come before the one with this name
+   const int NName { AcronymList->FindName( AName ) }, NMap { AcronymList->FindEntry( AIndx ) };
+   if( ErrorCondition( NMap < 0 || ( NName >= 0 && NName <= NMap ), ERR_ACROBADADDITION ) ) return -1;
+   if( NName >= 0 )
    {
-      const auto &obj = ( *AcronymList )[N];
-      if( sameTextPChar( obj.AcrName.c_str(), AName ) )
-      {
-         // NOTE: Not covered by unit tests yet.
-         if( ErrorCondition( obj.AcrMap == AIndx, ERR_ACROBADADDITION ) ) return -1;
-         return N;
-      }
-      if( ErrorCondition( obj.AcrMap != AIndx, ERR_ACROBADADDITION ) ) return -1;
+      // NOTE: Not covered by unit tests yet.
+      if( ErrorCondition( ( *AcronymList )[NName].AcrMap == AIndx, ERR_ACROBADADDITION ) ) return -1;
+      return NName;
    }
    int res { AcronymList->AddEntry( AName, Txt, AIndx ) };
    ( *AcronymList )[res].AcrReadMap = AIndx;
@@ -3246,7 +3596,7 @@ int TGXFileObj::gdxAcronymName( double V, char *AName )
 {
    //not an acronym
    if( const int Indx { gdxAcronymIndex( V ) };
-      Indx <= 0 )
+      Indx <= 0 || !LoadDeferredAcronyms() )
       AName[0] = '\0';
    else
    {
@@ -3287,7 +3637,7 @@ int TGXFileObj::gdxFileInfo( int &FileVer, int &ComprLev ) const
          ComprLev = fComprLev;
          break;
       case stat_write:
-         FileVer = VERSION;
+         FileVer = VersionRead;
          ComprLev = fComprLev;
          break;
    }
@@ -3320,14 +3670,11 @@ int TGXFileObj::gdxDataReadSliceStart( int SyNr, int *ElemCounts )
    {
       auto &obj = SliceIndxs[D];
       int Cnt {};
-      for( int N {}; N <= obj.GetHighestIndex(); N++ )
+      for( int N { obj.NextMapped( 0 ) }; N >= 0; N = obj.NextMapped( N + 1 ) )
       {
-         if( obj.GetMapping( N ) >= 0 )
-         {
-            obj.SetMapping( N, Cnt );// we keep it zero based
-            SliceRevMap[D].SetMapping( Cnt, N );
-            Cnt++;
-         }
+         obj.SetMapping( N, Cnt );// we keep it zero based
+         SliceRevMap[D].SetMapping( Cnt, N );
+         Cnt++;
       }
       ElemCounts[D] = Cnt;
    }
@@ -3407,7 +3754,7 @@ int64_t TGXFileObj::gdxGetMemoryUsed()
    int64_t res {};
    if( UELTable ) res += UELTable->MemoryUsed();
    if( SetTextList ) res += SetTextList->MemoryUsed();
-   if( NameList ) res += NameList->MemoryUsed();
+   if( NameList ) res += NameList->MemoryUsed() + SymbolArena.MemoryUsed();
    if( DomainStrList ) res += DomainStrList->MemoryUsed();
    if( SortList ) res += SortList->MemoryUsed();
    if( ErrorList ) res += ErrorList->MemoryUsed();
@@ -3540,10 +3887,8 @@ int TGXFileObj::gdxSymbolAddComment( int SyNr, const char *Txt )
       ReportError( ERR_NOSYMBOLFORCOMMENT );
       return false;
    }
-   if( !SyPtr->SCommentsList )
-      SyPtr->SCommentsList = std::make_optional<TCommentsList>();
    // AS: Limit to 255 characters since this will be stored as ShortString when saving comments list to GDX file on gdxClose
-   SyPtr->SCommentsList->Add( Txt, std::min<int>( 255, (int) std::strlen( Txt ) ) );
+   SymbolArena.AddComment( *SyPtr, Txt, std::min<int>( 255, (int) std::strlen( Txt ) ) );
    return true;
 }
 
@@ -3551,10 +3896,10 @@ int TGXFileObj::gdxSymbolGetComment( int SyNr, int N, char *Txt )
 {
    if( NameList && !NameList->empty() && SyNr >= 1 && SyNr <= NameList->size() )
    {
-      if( TgdxSymbRecord *const obj = *NameList->GetObject( SyNr );
-         obj->SCommentsList && !obj->SCommentsList->empty() && N >= 1 && N <= obj->SCommentsList->size() )
+      if( const TgdxSymbRecord *obj = *NameList->GetObject( SyNr );
+          N >= 1 && N <= static_cast<int>( obj->SComments.size() ) )
       {
-         assignPCharToBuf( ( *obj->SCommentsList )[N - 1], Txt, GMS_SSSIZE );
+         assignPCharToBuf( SymbolArena.GetComment( *obj, N ), Txt, GMS_SSSIZE );
          return true;
       }
    }
@@ -3564,13 +3909,13 @@ int TGXFileObj::gdxSymbolGetComment( int SyNr, int N, char *Txt )
 
 int TGXFileObj::gdxUELMaxLength() const
 {
-   return UELTable->GetMaxUELLength();
+   return LoadDeferredSections() ? UELTable->GetMaxUELLength() : 0;
 }
 
 int TGXFileObj::gdxUMFindUEL( const char *Uel, int &UelNr, int &UelMap )
 {
    UelMap = -1;
-   if( !UELTable )
+   if( !UELTable || !LoadDeferredSections() )
    {
       UelNr = -1;
       return false;
@@ -3614,13 +3959,43 @@ void TGXFileObj::gdxMapAcronymsToNaNSet( int flag )
    MapAcrToNaN = flag;
 }
 
+int TGXFileObj::gdxFooterIndex() const
+{
+   return FooterIndex;
+}
+
+void TGXFileObj::gdxFooterIndexSet( int flag )
+{
+   FooterIndex = flag;
+}
+
+int TGXFileObj::gdxStoreFingerprints() const
+{
+   return StoreFingerprints;
+}
+
+void TGXFileObj::gdxStoreFingerprintsSet( int flag )
+{
+   StoreFingerprints = flag;
+}
+
+int TGXFileObj::gdxDataErrorLimit() const
+{
+   return ErrorLimit;
+}
+
+void TGXFileObj::gdxDataErrorLimitSet( int flag )
+{
+   ErrorLimit = flag;
+}
+
 int TGXFileObj::gdxDataReadRawFastFilt( int SyNr, const char **UelFilterStr, TDataStoreFiltProc_t DP )
 {
    gdxDataReadRawFastFilt_DP = DP;
    bool res {};
    const auto XDomains { arrayWithValue<int, GLOBAL_MAX_INDEX_DIM>( DOMC_UNMAPPED ) };
    // -- Note: PrepareSymbolRead checks for the correct status
-   const int NrRecs { PrepareSymbolRead( "gdxDataReadRawFastFilt"s, SyNr, XDomains.data(), fr_raw_data ) };
+   const int64_t NrRecs { PrepareSymbolRead( "gdxDataReadRawFastFilt"s, SyNr, XDomains.data(), fr_raw_data ) };
    if( NrRecs >= 0 )
    {
       bool GoodIndx { true };
@@ -3670,7 +4045,7 @@ int TGXFileObj::gdxDataReadRawFastFilt( int SyNr, const char **UelFilterStr, TDa
 int TGXFileObj::gdxDataReadRawFast( int SyNr, TDataStoreProc_t DP, int &NrRecs )
 {
    const auto XDomains { arrayWithValue<int, GLOBAL_MAX_INDEX_DIM>( DOMC_UNMAPPED ) };
-   NrRecs = PrepareSymbolRead( "gdxDataReadRawFast"s, SyNr, XDomains.data(), fr_raw_data );
+   NrRecs = RecordCount32( PrepareSymbolRead( "gdxDataReadRawFast"s, SyNr, XDomains.data(), fr_raw_data ) );
    std::array<double, GMS_VAL_SCALE + 1> AVals {};
    int AFDim;
    while( DoRead( AVals.data(), AFDim ) )
@@ -3685,7 +4060,7 @@ int TGXFileObj::gdxDataReadRawFastEx( int SyNr, TDataStoreExProc_t DP, int &NrRe
    TgdxUELIndex XDomains;
    //do not know dimension yet
    std::fill( XDomains.begin(), XDomains.end(), DOMC_UNMAPPED );
-   NrRecs = PrepareSymbolRead( "gdxDataReadRawFastEx"s, SyNr, XDomains.data(), fr_raw_data );
+   NrRecs = RecordCount32( PrepareSymbolRead( "gdxDataReadRawFastEx"s, SyNr, XDomains.data(), fr_raw_data ) );
    std::array<double, valscale + 1> AVals {};
    int AFDim;
    if( gdxDataReadRawFastEx_DP_CallByRef )
@@ -3894,6 +4269,282 @@ void TUELTable::ResetMapToUserStatus()
    FMapToUserStatus = TUELUserMapStatus::map_unknown;
 }
 
+uint32_t TUELTableCompact::Hash( const char *s )
+{
+   // same case folding hash as the default UEL table, UELs are case insensitive
+   return static_cast<uint32_t>( gdlib::strhash::HashText<true>( s, std::strlen( s ) ) );
+}
+
+// returns the slot holding an entry equal to s or the empty slot where it would be inserted
+uint32_t TUELTableCompact::FindSlot( const char *s, const uint32_t HV ) const
+{
+   uint32_t i { HV & SlotMask };
+   while( Slots[i] )
+   {
+      if( SlotHashes[i] == HV && utils::sameTextPChar( &Arena[Offsets[Slots[i] - 1]], s ) )
+         break;
+      i = ( i + 1 ) & SlotMask;
+   }
+   return i;
+}
+
+void TUELTableCompact::InsertSlot( const uint32_t EN, const uint32_t HV )
+{
+   uint32_t i { HV & SlotMask };
+   while( Slots[i] ) i = ( i + 1 ) & SlotMask;
+   Slots[i] = EN;
+   SlotHashes[i] = HV;
+}
+
+void TUELTableCompact::RemoveSlot( const uint32_t EN )
+{
+   uint32_t i { Hash( &Arena[Offsets[EN - 1]] ) & SlotMask };
+   while( Slots[i] != EN ) i = ( i + 1 ) & SlotMask;
+   // backward shift deletion keeps the probe sequences intact without tombstones
+   for( uint32_t j { ( i + 1 ) & SlotMask }; Slots[j]; j = ( j + 1 ) & SlotMask )
+   {
+      const uint32_t k { SlotHashes[j] & SlotMask };// home slot of entry in j
+      if( i <= j ? ( i < k && k <= j ) : ( i < k || k <= j ) ) continue;
+      Slots[i] = Slots[j];
+      SlotHashes[i] = SlotHashes[j];
+      i = j;
+   }
+   Slots[i] = 0;
+}
+
+void TUELTableCompact::GrowSlots( const size_t MinEntries )
+{
+   // keep the load factor at or below 0.5
+   size_t NewSize { 1024 };
+   while( NewSize < 2 * MinEntries ) NewSize *= 2;
+   if( NewSize <= Slots.size() ) return;
+   gdlib::gmsalloc::TVector<uint32_t> OldSlots( NewSize ), OldHashes( NewSize );
+   std::swap( OldSlots, Slots );
+   std::swap( OldHashes, SlotHashes );
+   SlotMask = static_cast<uint32_t>( NewSize - 1 );
+   for( size_t i {}; i < OldSlots.size(); i++ )
+      if( OldSlots[i] ) InsertSlot( OldSlots[i], OldHashes[i] );
+}
+
+int TUELTableCompact::AppendEntry( const char *s, const size_t slen, const int mapping )
+{
+   assert( Offsets.size() < static_cast<size_t>( std::numeric_limits<int>::max() ) );
+   Offsets.push_back( static_cast<int64_t>( Arena.size() ) );
+   Arena.insert( Arena.end(), s, s + slen );
+   Arena.push_back( '\0' );
+   UserMaps.push_back( mapping );
+   if( FMaxUELLength >= 0 ) FMaxUELLength = std::max( FMaxUELLength, static_cast<int>( slen ) );
+   return static_cast<int>( Offsets.size() );
+}
+
+TUELTableCompact::TUELTableCompact() : UsrUel2Ent { std::make_unique<TIntegerMapping>() }
+{
+   GrowSlots( 0 );
+   ResetMapToUserStatus();
+}
+
+void TUELTableCompact::Clear()
+{
+   Arena.clear();
+   Offsets.clear();
+   UserMaps.clear();
+   std::fill( Slots.begin(), Slots.end(), 0 );
+   FMaxUELLength = 0;
+   UsrUel2Ent = std::make_unique<TIntegerMapping>();
+   ResetMapToUserStatus();
+}
+
+void TUELTableCompact::SetCapacity( const int n, const size_t strBytes )
+{
+   if( n <= 0 ) return;
+   Offsets.reserve( n );
+   UserMaps.reserve( n );
+   // same lower bound as TXStrHashList: at least 1 char + terminator per UEL
+   Arena.reserve( !strBytes ? 2 * static_cast<size_t>( n ) : strBytes );
+   GrowSlots( n );
+}
+
+int TUELTableCompact::size() const
+{
+   return static_cast<int>( Offsets.size() );
+}
+
+bool TUELTableCompact::empty() const
+{
+   return Offsets.empty();
+}
+
+int TUELTableCompact::GetUserMap( const int i ) const
+{
+   return UserMaps[i - 1];
+}
+
+void TUELTableCompact::SetUserMap( const int EN, const int N )
+{
+   UserMaps[EN - 1] = N;
+}
+
+int TUELTableCompact::NewUsrUel( const int EN )
+{
+   int res = UserMaps[EN - 1];
+   if( res < 0 )
+   {
+      res = UsrUel2Ent->GetHighestIndex() + 1;
+      UserMaps[EN - 1] = res;
+      UsrUel2Ent->SetMapping( res, EN );
+   }
+   ResetMapToUserStatus();
+   return res;
+}
+
+int TUELTableCompact::AddUsrNew( const char *s, const size_t slen )
+{
+   return NewUsrUel( AddObject( s, slen, -1 ) );
+}
+
+int TUELTableCompact::AddUsrIndxNew( const char *s, const size_t slen, const int UelNr )
+{
+   const int EN { AddObject( s, slen, -1 ) };
+   int res { UserMaps[EN - 1] };
+   if( res < 0 )
+   {
+      res = UelNr;
+      UserMaps[EN - 1] = res;
+      UsrUel2Ent->SetMapping( res, EN );
+   }
+   else if( res != UelNr )
+   {
+      res = -1;
+   }
+   ResetMapToUserStatus();
+   return res;
+}
+
+int TUELTableCompact::GetMaxUELLength() const
+{
+   if( FMaxUELLength < 0 )
+   {
+      FMaxUELLength = 0;
+      for( const int64_t offset: Offsets )
+         FMaxUELLength = std::max<int>( static_cast<int>( strlen( &Arena[offset] ) ), FMaxUELLength );
+   }
+   return FMaxUELLength;
+}
+
+int TUELTableCompact::IndexOf( const char *s ) const
+{
+   const uint32_t slot { FindSlot( s, Hash( s ) ) };
+   return Slots[slot] ? static_cast<int>( Slots[slot] ) : -1;
+}
+
+int TUELTableCompact::AddObject( const char *id, const size_t idlen, const int mapping )
+{
+   const uint32_t HV { Hash( id ) };
+   uint32_t slot { FindSlot( id, HV ) };
+   if( Slots[slot] ) return static_cast<int>( Slots[slot] );
+   if( 2 * ( Offsets.size() + 1 ) > Slots.size() )
+   {
+      GrowSlots( Offsets.size() + 1 );
+      slot = FindSlot( id, HV );
+   }
+   const int EN { AppendEntry( id, idlen, mapping ) };
+   Slots[slot] = EN;
+   SlotHashes[slot] = HV;
+   return EN;
+}
+
+int TUELTableCompact::StoreObject( const char *id, const size_t idlen, const int mapping )
+{
+   // caller guarantees id is not in the table yet (e.g. reading the UEL list of a file)
+   if( 2 * ( Offsets.size() + 1 ) > Slots.size() )
+      GrowSlots( Offsets.size() + 1 );
+   const int EN { AppendEntry( id, idlen, mapping ) };
+   InsertSlot( EN, Hash( &Arena[Offsets.back()] ) );
+   return EN;
+}
+
+const char *TUELTableCompact::operator[]( const int index ) const
+{
+   return &Arena[Offsets[index - 1]];
+}
+
+void TUELTableCompact::RenameEntry( const int N, const char *s )
+{
+   RemoveSlot( N );
+   // the longest label may be the one that gets shorter
+   if( FMaxUELLength >= 0 && static_cast<int>( std::strlen( &Arena[Offsets[N - 1]] ) ) == FMaxUELLength )
+      FMaxUELLength = -1;
+   // old label stays in the arena until the table is cleared
+   const size_t slen { std::strlen( s ) };
+   Offsets[N - 1] = static_cast<int64_t>( Arena.size() );
+   Arena.insert( Arena.end(), s, s + slen );
+   Arena.push_back( '\0' );
+   if( FMaxUELLength >= 0 ) FMaxUELLength = std::max( FMaxUELLength, static_cast<int>( slen ) );
+   InsertSlot( N, Hash( s ) );
+}
+
+int TUELTableCompact::MemoryUsed() const
+{
+   const size_t res { Arena.capacity() + Offsets.capacity() * sizeof( int64_t ) + UserMaps.capacity() * sizeof( int ) +
+                      ( Slots.capacity() + SlotHashes.capacity() ) * sizeof( uint32_t ) };
+   return static_cast<int>( res ) + UsrUel2Ent->MemoryUsed();
+}
+
+void TUELTableCompact::SaveToStream( TXStream &S )
+{
+   S.WriteInteger( size() );
+   for( const int64_t offset: Offsets )
+      S.WriteString( &Arena[offset] );
+}
+
+void TUELTableCompact::LoadFromStream( TXStream &S )
+{
+   Clear();
+   const int Cnt { S.ReadInteger() };
+   SetCapacity( Cnt );
+   for( int N {}; N < Cnt; N++ )
+   {
+      uint8_t slen;
+      char sbuf[256];
+      S.ReadSString( sbuf, slen );
+      StoreObject( sbuf, slen, -1 );
+   }
+   ResetMapToUserStatus();
+}
+
+TUELUserMapStatus TUELTableCompact::GetMapToUserStatus()
+{
+   if( FMapToUserStatus == TUELUserMapStatus::map_unknown )
+   {
+      FMapToUserStatus = TUELUserMapStatus::map_sortgrow;
+      bool C { true };
+      int LV { -1 };
+      for( const int V: UserMaps )
+      {
+         if( V < 0 ) C = false;
+         else if( V > LV )
+         {
+            LV = V;
+            // saw some un-init/neg values
+            if( !C ) FMapToUserStatus = TUELUserMapStatus::map_sorted;
+         }
+         else
+         {
+            FMapToUserStatus = TUELUserMapStatus::map_unsorted;
+            break;
+         }
+      }
+      if( FMapToUserStatus == TUELUserMapStatus::map_sortgrow && C )
+         FMapToUserStatus = TUELUserMapStatus::map_sortfull;// fully strictly growing
+   }
+   return FMapToUserStatus;
+}
+
+void TUELTableCompact::ResetMapToUserStatus()
+{
+   FMapToUserStatus = TUELUserMapStatus::map_unknown;
+}
+
 TgxModeSet::TgxModeSet( const std::initializer_list<TgxFileMode> &modes )
 {
    for( const auto mode: modes )
@@ -3913,6 +4564,78 @@ inline bool TgxModeSet::empty() const
    return !count;
 }
 
+TSymbolArena::TSymbolArena()
+{
+   StrPool.push_back( '\0' );
+}
+
+TgdxSymbRecord *TSymbolArena::NewSymbol()
+{
+   RecBytes += sizeof( TgdxSymbRecord );
+   return new( RecAlloc.GetBytes<TgdxSymbRecord>() ) TgdxSymbRecord {};
+}
+
+// only runs the destructor, the memory is released by Clear
+void TSymbolArena::FreeSymbol( TgdxSymbRecord *Sym )
+{
+   Sym->~TgdxSymbRecord();
+}
+
+int *TSymbolArena::NewIntArray( const int Count )
+{
+   DataBytes += Count * static_cast<int64_t>( sizeof( int ) );
+   auto *res { reinterpret_cast<int *>( DataAlloc.GetBytes( Count * sizeof( int ) ) ) };
+   std::fill_n( res, Count, 0 );
+   return res;
+}
+
+int64_t TSymbolArena::AddString( const char *s, const size_t slen )
+{
+   if( !slen ) return 0;
+   const auto res { static_cast<int64_t>( StrPool.size() ) };
+   StrPool.insert( StrPool.end(), s, s + slen );
+   StrPool.push_back( '\0' );
+   return res;
+}
+
+const char *TSymbolArena::GetString( const int64_t Offset ) const
+{
+   return &StrPool[Offset];
+}
+
+void TSymbolArena::AddComment( TgdxSymbRecord &Sym, const char *s, const size_t slen )
+{
+   DataBytes -= static_cast<int64_t>( Sym.SComments.capacity() * sizeof( int64_t ) );
+   Sym.SComments.push_back( AddString( s, slen ) );
+   DataBytes += static_cast<int64_t>( Sym.SComments.capacity() * sizeof( int64_t ) );
+}
+
+const char *TSymbolArena::GetComment( const TgdxSymbRecord &Sym, const int N ) const
+{
+   return N >= 1 && N <= static_cast<int>( Sym.SComments.size() ) ? GetString( Sym.SComments[N - 1] ) : nullptr;
+}
+
+void TSymbolArena::SetCapacity( const int NrSymbols )
+{
+   if( NrSymbols <= 0 ) return;
+   RecAlloc.SetFirstBatchSize( NrSymbols * sizeof( TgdxSymbRecord ) );
+   // rough guess of a short explanatory text per symbol
+   StrPool.reserve( StrPool.size() + NrSymbols * 32 );
+}
+
+void TSymbolArena::Clear()
+{
+   RecAlloc.clear();
+   DataAlloc.clear();
+   StrPool.resize( 1 );
+   RecBytes = DataBytes = 0;
+}
+
+int64_t TSymbolArena::MemoryUsed() const
+{
+   return RecBytes + DataBytes + static_cast<int64_t>( StrPool.capacity() );
+}
+
 TAcronymList::~TAcronymList()
 {
    if(!useBatchAlloc)
@@ -3930,18 +4653,93 @@ TAcronymList::~TAcronymList()
    }
 }
 
-int TAcronymList::FindEntry( int Map )
+static uint32_t AcronymMapHash( const int Map )
 {
+   return static_cast<uint32_t>( gdlib::strhash::Mix64( static_cast<uint32_t>( Map ) ) );
+}
+
+static uint32_t AcronymNameHash( const std::string &Name )
+{
+   return static_cast<uint32_t>( gdlib::strhash::HashText<true>( Name.c_str(), Name.length() ) );
+}
+
+void TAcronymList::Reindex( const int MinSlots )
+{
+   // keep the load factor at or below 0.5
+   int NewSize { 16 };
+   while( NewSize < 2 * MinSlots ) NewSize *= 2;
+   MapSlots.assign( NewSize, 0 );
+   NameSlots.assign( NewSize, 0 );
    for( int N {}; N < FList.GetCount(); N++ )
-      if( FList[N]->AcrMap == Map )
+   {
+      InsertMapSlot( N );
+      InsertNameSlot( N );
+   }
+   NameSlotsValid = true;
+}
+
+void TAcronymList::InsertMapSlot( const int N )
+{
+   const int Map { FList[N]->AcrMap }, Mask { static_cast<int>( MapSlots.size() ) - 1 };
+   for( int i { static_cast<int>( AcronymMapHash( Map ) ) & Mask };; i = ( i + 1 ) & Mask )
+   {
+      if( !MapSlots[i] )
+      {
+         MapSlots[i] = N + 1;
+         return;
+      }
+      if( FList[MapSlots[i] - 1]->AcrMap == Map ) return;
+   }
+}
+
+void TAcronymList::InsertNameSlot( const int N )
+{
+   const std::string &Name { FList[N]->AcrName };
+   if( Name.empty() ) return;// placeholders added by CheckEntry/AcronymRemap
+   const int Mask { static_cast<int>( NameSlots.size() ) - 1 };
+   for( int i { static_cast<int>( AcronymNameHash( Name ) ) & Mask };; i = ( i + 1 ) & Mask )
+   {
+      if( !NameSlots[i] )
+      {
+         NameSlots[i] = N + 1;
+         return;
+      }
+      if( sameTextPChar( FList[NameSlots[i] - 1]->AcrName.c_str(), Name.c_str() ) ) return;
+   }
+}
+
+int TAcronymList::FindEntry( int Map )
+{
+   // values of one acronym usually come in runs
+   if( LastEntry >= 0 && LastMap == Map ) return LastEntry;
+   if( MapSlots.empty() ) return -1;
+   const int Mask { static_cast<int>( MapSlots.size() ) - 1 };
+   for( int i { static_cast<int>( AcronymMapHash( Map ) ) & Mask }; MapSlots[i]; i = ( i + 1 ) & Mask )
+   {
+      if( const int N { MapSlots[i] - 1 }; FList[N]->AcrMap == Map )
+      {
+         LastMap = Map;
+         LastEntry = N;
          return N;
+      }
+   }
    return -1;
 }
 
 int TAcronymList::FindName( const char *Name )
 {
-   for( int N {}; N < FList.GetCount(); N++ )
-      if( sameTextPChar( FList[N]->AcrName.c_str(), Name ) )
+   if( !Name[0] )
+   {
+      for( int N {}; N < FList.GetCount(); N++ )
+         if( FList[N]->AcrName.empty() )
+            return N;
+      return -1;
+   }
+   if( !NameSlotsValid ) Reindex( FList.GetCount() );
+   const std::string SName { Name };
+   const int Mask { static_cast<int>( NameSlots.size() ) - 1 };
+   for( int i { static_cast<int>( AcronymNameHash( SName ) ) & Mask }; NameSlots[i]; i = ( i + 1 ) & Mask )
+      if( const int N { NameSlots[i] - 1 }; sameTextPChar( FList[N]->AcrName.c_str(), Name ) )
          return N;
    return -1;
 }
@@ -3949,7 +4747,14 @@ int TAcronymList::FindName( const char *Name )
 int TAcronymList::AddEntry( const char *Name, const char *Text, int Map )
 {
    TAcronym *acro {useBatchAlloc ? new (batchAlloc.GetBytes<TAcronym>()) TAcronym {Name, Text, Map} : new TAcronym { Name, Text, Map }};
-   return FList.Add( acro );
+   const int N { FList.Add( acro ) };
+   if( 2 * FList.GetCount() > static_cast<int>( MapSlots.size() ) ) Reindex( FList.GetCount() );
+   else
+   {
+      InsertMapSlot( N );
+      if( NameSlotsValid ) InsertNameSlot( N );
+   }
+   return N;
 }
 
 void TAcronymList::CheckEntry( int Map )
@@ -3958,6 +4763,13 @@ void TAcronymList::CheckEntry( int Map )
       AddEntry( "", "", Map );
 }
 
+void TAcronymList::SetNameAndText( const int N, const char *Name, const char *Text )
+{
+   FList[N]->SetNameAndText( Name, Text );
+   // renames only happen through gdxAcronymSetInfo, rebuild the name index on the next lookup
+   NameSlotsValid = false;
+}
+
 void TAcronymList::SaveToStream( TXStream &S )
 {
    S.WriteInteger( FList.GetCount() );
@@ -3977,6 +4789,8 @@ void TAcronymList::LoadFromStream( TXStream &S )
       TAcronym *acro = useBatchAlloc ? new (batchAlloc.GetBytes<TAcronym>()) TAcronym { S } : new TAcronym { S };
       FList.Add( acro );
    }
+   LastEntry = -1;
+   Reindex( Cnt );
 }
 
 // NOTE: Not covered by unit tests yet.
@@ -3988,7 +4802,7 @@ int TAcronymList::MemoryUsed()
    return res;
 }
 
-inline int TAcronymList::size() const
+int TAcronymList::size() const
 {
    return FList.GetCount();
 }
@@ -3998,6 +4812,81 @@ TAcronym &TAcronymList::operator[]( int Index )
    return *FList[Index];
 }
 
+static int ErrorRecBytes( const int Dim, const int DataSize )
+{
+   // keys padded to 8 bytes, so the values stay aligned
+   return ( ( Dim * static_cast<int>( sizeof( int ) ) + 7 ) & ~7 ) + DataSize * static_cast<int>( sizeof( double ) );
+}
+
+TErrorList::TErrorList( const int Dim, const int DataSize, const int Limit )
+    : FDim { Dim }, FDataSize { DataSize }, FKeyBytes { ( Dim * static_cast<int>( sizeof( int ) ) + 7 ) & ~7 }, FLimit { Limit },
+      // a small limit only needs one small chunk
+      Recs { ErrorRecBytes( Dim, DataSize ), Limit < 0 || Limit > gdlib::gmsdata::BufSize ? gdlib::gmsdata::BufSize : std::max( 1, Limit ) * ErrorRecBytes( Dim, DataSize ) },
+      NegKeys( Dim )
+{
+}
+
+bool TErrorList::AddRecord( const int *Keys, const double *Vals )
+{
+   if( FLimit >= 0 && Recs.GetCount() >= FLimit )
+   {
+      FOverflow++;
+      return false;
+   }
+   uint8_t *P { Recs.ReserveMem() };
+   std::memcpy( P, Keys, FDim * sizeof( int ) );
+   std::memcpy( P + FKeyBytes, Vals, FDataSize * sizeof( double ) );
+   for( int D {}; D < FDim; D++ )
+      if( Keys[D] < 0 ) NegKeys[D].SetBit( -Keys[D], true );
+   return true;
+}
+
+bool TErrorList::HasNegKey( const int D, const int EN ) const
+{
+   return NegKeys[D].GetBit( -EN );
+}
+
+void TErrorList::GetRecord( const int64_t N, int *Keys, double *Vals ) const
+{
+   const uint8_t *P { Recs.GetItemPtrIndexConst( N ) };
+   std::memcpy( Keys, P, FDim * sizeof( int ) );
+   std::memcpy( Vals, P + FKeyBytes, FDataSize * sizeof( double ) );
+}
+
+// copies up to Cnt records starting with record First: FDim keys per record to Keys, the values of
+// record i to Vals + i * ValStride
+int64_t TErrorList::GetRecords( const int64_t First, int64_t Cnt, int *Keys, double *Vals, const int ValStride ) const
+{
+   if( First < 0 || First >= Recs.GetCount() ) return 0;
+   Cnt = std::min( Cnt, Recs.GetCount() - First );
+   for( int64_t i {}; i < Cnt; i++ )
+      GetRecord( First + i, Keys + i * FDim, Vals + i * ValStride );
+   return Cnt;
+}
+
+int64_t TErrorList::GetCount() const
+{
+   return Recs.GetCount();
+}
+
+int64_t TErrorList::OverflowCount() const
+{
+   return FOverflow;
+}
+
+int TErrorList::GetDimension() const
+{
+   return FDim;
+}
+
+int64_t TErrorList::MemoryUsed() const
+{
+   int64_t res { Recs.MemoryUsed() };
+   for( const auto &B: NegKeys )
+      res += B.MemoryUsed();
+   return res;
+}
+
 void TFilterList::AddFilter( TDFilter *F )
 {
    for( int N {}; N < FList.size(); N++ )
@@ -4058,20 +4947,74 @@ void TIntegerMapping::growMapping( int F )
    FCapacity = currCap;
    FMapBytes = static_cast<int64_t>( FCapacity * sizeof( int ) );
    assert(FMapBytes);
-   if( !PMap ) PMap = static_cast<int *>( std::malloc( FMapBytes ) );
-   else
+   auto *NewMap { static_cast<int *>( gdlib::gmsalloc::Allocate( FMapBytes ) ) };
+   if( PMap )
    {
-      void *p = std::realloc( PMap, FMapBytes );
-      if( p ) PMap = static_cast<int *>( p );
+      std::memcpy( NewMap, PMap, prevCap * sizeof( int ) );
+      gdlib::gmsalloc::Free( PMap );
    }
-   assert( PMap && "Problem allocating memory for integer mapping!" );
-   if( PMap )
-      std::memset( &PMap[prevCap], -1, sizeof( int ) * ( FCapacity - prevCap ) );
+   PMap = NewMap;
+   std::memset( &PMap[prevCap], -1, sizeof( int ) * ( FCapacity - prevCap ) );
+}
+
+void TIntegerMapping::toPaged()
+{
+   assert( !FPaged );
+   Pages.assign( ( FCapacity + PageSize - 1 ) / PageSize, nullptr );
+   FPageCount = 0;
+   for( int64_t P {}; P < static_cast<int64_t>( Pages.size() ); P++ )
+   {
+      // the flat array does not have to end on a page boundary
+      const int *Src { &PMap[P * PageSize] };
+      const int64_t Cnt { std::min<int64_t>( PageSize, FCapacity - P * PageSize ) };
+      if( std::all_of( Src, Src + Cnt, []( const int v ) { return v == -1; } ) ) continue;
+      Pages[P] = static_cast<int *>( gdlib::gmsalloc::Allocate( PageSize * sizeof( int ) ) );
+      std::memcpy( Pages[P], Src, Cnt * sizeof( int ) );
+      std::fill( Pages[P] + Cnt, Pages[P] + PageSize, -1 );
+      FPageCount++;
+   }
+   gdlib::gmsalloc::Free( PMap );
+   PMap = nullptr;
+   FPaged = true;
+   FCapacity = static_cast<int64_t>( Pages.size() ) * PageSize;
+   FMapBytes = static_cast<int64_t>( FPageCount ) * PageSize * sizeof( int ) + static_cast<int64_t>( Pages.capacity() * sizeof( int * ) );
+}
+
+void TIntegerMapping::toDense()
+{
+   assert( FPaged );
+   // leave room for growth like growMapping, so the next indices do not reallocate right away
+   const int64_t PagedCapacity { static_cast<int64_t>( Pages.size() ) * PageSize },
+                 NewCapacity { std::min<int64_t>( PagedCapacity + PagedCapacity / 2, FMAXCAPACITY ) };
+   PMap = static_cast<int *>( gdlib::gmsalloc::Allocate( NewCapacity * sizeof( int ) ) );
+   for( int64_t P {}; P < static_cast<int64_t>( Pages.size() ); P++ )
+   {
+      const int64_t Cnt { std::min<int64_t>( PageSize, NewCapacity - P * PageSize ) };
+      if( Pages[P] ) std::memcpy( &PMap[P * PageSize], Pages[P], Cnt * sizeof( int ) );
+      else
+         std::memset( &PMap[P * PageSize], -1, Cnt * sizeof( int ) );
+   }
+   if( NewCapacity > PagedCapacity )
+      std::memset( &PMap[PagedCapacity], -1, ( NewCapacity - PagedCapacity ) * sizeof( int ) );
+   freePages();
+   FPaged = false;
+   FCapacity = NewCapacity;
+   FMapBytes = FCapacity * static_cast<int64_t>( sizeof( int ) );
+}
+
+void TIntegerMapping::freePages()
+{
+   for( int *Page: Pages )
+      gdlib::gmsalloc::Free( Page );
+   Pages.clear();
+   Pages.shrink_to_fit();
+   FPageCount = 0;
 }
 
 TIntegerMapping::~TIntegerMapping()
 {
-   std::free( PMap );
+   gdlib::gmsalloc::Free( PMap );
+   freePages();
 }
 
 int TIntegerMapping::MemoryUsed() const
@@ -4086,16 +5029,72 @@ int TIntegerMapping::GetHighestIndex() const
 
 int TIntegerMapping::GetMapping( int F ) const
 {
-   return F >= 0 && F < FCapacity ? PMap[F] : -1;
+   if( F < 0 || F >= FCapacity ) return -1;
+   if( !FPaged ) return PMap[F];
+   const int *Page { Pages[F >> PageBits] };
+   return Page ? Page[F & ( PageSize - 1 )] : -1;
 }
 
 void TIntegerMapping::SetMapping( int F, int T )
 {
-   if( F >= FCapacity ) growMapping( F );
-   PMap[F] = T;
+   if( !FPaged && F >= FCapacity )
+   {
+      if( F < DenseMinCapacity || static_cast<int64_t>( FMappedCount ) * DenseFillFactor >= F ) growMapping( F );
+      else
+         toPaged();
+   }
+   if( !FPaged )
+   {
+      if( PMap[F] == -1 ) FMappedCount++;
+      PMap[F] = T;
+   }
+   else
+   {
+      const int P { F >> PageBits };
+      if( P >= static_cast<int>( Pages.size() ) )
+      {
+         Pages.resize( P + 1, nullptr );
+         FCapacity = static_cast<int64_t>( Pages.size() ) * PageSize;
+      }
+      int *&Page { Pages[P] };
+      if( !Page )
+      {
+         Page = static_cast<int *>( gdlib::gmsalloc::Allocate( PageSize * sizeof( int ) ) );
+         std::memset( Page, -1, PageSize * sizeof( int ) );
+         FPageCount++;
+      }
+      int &Entry { Page[F & ( PageSize - 1 )] };
+      if( Entry == -1 ) FMappedCount++;
+      Entry = T;
+      FMapBytes = static_cast<int64_t>( FPageCount ) * PageSize * sizeof( int ) + static_cast<int64_t>( Pages.capacity() * sizeof( int * ) );
+      // same density measure as for leaving the flat array, but twice as dense,
+      // so sparse indices cannot make the mapping switch back and forth
+      if( static_cast<int64_t>( FMappedCount ) * DenseFillFactor >= 2 * FCapacity ) toDense();
+   }
    if( F > FHighestIndex ) FHighestIndex = F;
 }
 
+int TIntegerMapping::NextMapped( int F ) const
+{
+   const int64_t Last { std::min<int64_t>( FHighestIndex, FCapacity - 1 ) };
+   for( int64_t N { std::max( F, 0 ) }; N <= Last; )
+   {
+      if( FPaged && !Pages[N >> PageBits] )
+      {
+         N = ( ( N >> PageBits ) + 1 ) << PageBits;
+         continue;
+      }
+      if( GetMapping( static_cast<int>( N ) ) != -1 ) return static_cast<int>( N );
+      N++;
+   }
+   return -1;
+}
+
+bool TIntegerMapping::IsPaged() const
+{
+   return FPaged;
+}
+
 int TIntegerMapping::size() const
 {
    return static_cast<int>( FCapacity );
@@ -4110,9 +5109,11 @@ void TIntegerMapping::reset()
 {
    FCapacity = FMapBytes = 0;
    FMAXCAPACITY = std::numeric_limits<int>::max() + static_cast<int64_t>( 1 );
-   FHighestIndex = 0;
-   std::free(PMap);
+   FHighestIndex = FMappedCount = 0;
+   gdlib::gmsalloc::Free( PMap );
    PMap = nullptr;
+   freePages();
+   FPaged = false;
 }
 
 TAcronym::TAcronym( const char *Name, const char *Text, int Map ) : AcrName { Name },
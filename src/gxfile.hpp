@@ -28,8 +28,10 @@
 // Description:
 //  This unit defines the GDX Object as a C++ object.
 
+#include "batchalloc.hpp"    // for BatchAllocator
 #include "datastorage.hpp"   // for TLinkedData
 #include <gclgms.h>        // for GLOBAL_MAX_INDEX_DIM, GMS_MAX_INDEX_DIM
+#include "gmsalloc.hpp"      // for TVector
 #include "gmsdata.hpp"       // for TTblGamsData
 #include "gmsobj.hpp"        // for TBooleanBitArray, TXList, TXStrings
 #include "strhash.hpp"       // for TXCSStrHashList, TXStrHashList
@@ -42,6 +44,7 @@
 #include <memory>          // for unique_ptr, allocator
 #include <optional>        // for optional
 #include <string>          // for string
+#include <vector>          // for vector
 
 namespace gdlib::gmsstrm
 {
@@ -129,25 +132,50 @@ struct TDomain {
 
 using TDomainList = std::array<TDomain, GLOBAL_MAX_INDEX_DIM>;
 
-using TCommentsList = gdlib::gmsobj::TXStrings;
-
 struct TgdxSymbRecord final {
    int SSyNr;
    int64_t SPosition;
-   int SDim, SDataCount, SErrors;
+   int SDim;
+   int64_t SDataCount, SErrors;
    gdxSyType SDataType;
    int SUserInfo;
    bool SSetText;
-   utils::sstring SExplTxt;
+   int64_t SExplTxt;// offset in string pool of symbol arena
    bool SIsCompressed;
-   bool SScalarFrst;                  // not stored
-   std::unique_ptr<int[]> SDomSymbols,// real domain info
-                          SDomStrings;// relaxed domain info
-   std::optional<TCommentsList> SCommentsList;
+   bool SHasFingerprint;// fingerprint stored in an optional section, not in the symbol table
+   uint64_t SFingerprint;
+   bool SScalarFrst;// not stored
+   int *SDomSymbols,// real domain info
+       *SDomStrings;// relaxed domain info
+   gdlib::gmsalloc::TVector<int64_t> SComments;// offsets of the comment lines in the string pool of the symbol arena
    std::unique_ptr<TSetBitMap> SSetBitMap;// for 1-dim sets only
 };
 using PgdxSymbRecord = TgdxSymbRecord *;
 
+// Per file storage for the symbol table. Records and domain arrays are carved out of
+// large batches and released together, explanatory texts and comments are kept in one string pool
+// and referenced by offset.
+class TSymbolArena final
+{
+   gdlib::batchalloc::BatchAllocator<sizeof( TgdxSymbRecord ) * 256, 8> RecAlloc;
+   gdlib::batchalloc::BatchAllocator<4096, 8> DataAlloc;// domain arrays
+   gdlib::gmsalloc::TVector<char> StrPool;                           // '\0' terminated strings, offset 0 is the empty string
+   int64_t RecBytes {}, DataBytes {};
+
+public:
+   TSymbolArena();
+   TgdxSymbRecord *NewSymbol();
+   static void FreeSymbol( TgdxSymbRecord *Sym );
+   int *NewIntArray( int Count );
+   int64_t AddString( const char *s, size_t slen );
+   [[nodiscard]] const char *GetString( int64_t Offset ) const;
+   void AddComment( TgdxSymbRecord &Sym, const char *s, size_t slen );
+   [[nodiscard]] const char *GetComment( const TgdxSymbRecord &Sym, int N ) const;
+   void SetCapacity( int NrSymbols );
+   void Clear();
+   [[nodiscard]] int64_t MemoryUsed() const;
+};
+
 enum TgdxIntlValTyp : uint8_t
 {// values stored internally via the indicator byte
    vm_valund,
@@ -213,14 +241,25 @@ enum class TgdxElemSize : uint8_t
 // FMAXCAPACITY = high(integer) + 1 is all we will ever need, and we will
 // never get a request to grow any larger.  The checks and code
 // in growMapping reflect this
+// Small or well filled mappings use one flat array. When a high index is set while fewer than one
+// in DenseFillFactor entries are in use, the mapping switches to a directory of lazily allocated pages of
+// PageSize entries and goes back to the flat array once at least twice that share of entries is in use.
 class TIntegerMapping
 {
+   static constexpr int PageBits { 12 }, PageSize { 1 << PageBits },
+                        DenseMinCapacity { 1 << 16 },// never page below this capacity
+                        DenseFillFactor { 8 };       // stay flat while at least every 8th entry is used
    int64_t FCapacity {}, FMapBytes {};
    int64_t FMAXCAPACITY { std::numeric_limits<int>::max() + static_cast<int64_t>( 1 ) };
-   int FHighestIndex {};
-   int *PMap {};
+   int FHighestIndex {}, FMappedCount {}, FPageCount {};
+   int *PMap {};              // flat mode
+   gdlib::gmsalloc::TVector<int *> Pages {};// paged mode, nullptr for pages without any mapping
+   bool FPaged {};
 
    void growMapping( int F );
+   void toPaged();
+   void toDense();
+   void freePages();
 
 public:
    TIntegerMapping() = default;
@@ -229,6 +268,9 @@ public:
    [[nodiscard]] int GetHighestIndex() const;
    [[nodiscard]] int GetMapping( int F ) const;
    void SetMapping( int F, int T );
+   // smallest index >= F with a mapping or -1, skips pages that were never touched
+   [[nodiscard]] int NextMapped( int F ) const;
+   [[nodiscard]] bool IsPaged() const;
    [[nodiscard]] int size() const;
    [[nodiscard]] bool empty() const;
    void reset();
@@ -277,6 +319,63 @@ public:
    void ResetMapToUserStatus();
 };
 
+// Alternative UEL table with the same interface as TUELTable:
+// labels live back to back (null terminated) in one character arena and are found via an
+// open addressing hash table (linear probing, power of two size) that only stores
+// 32 bit entry numbers and hash values. This avoids one bucket and one string allocation per UEL
+// and keeps lookups cache friendly for universes with millions of labels.
+class TUELTableCompact final
+{
+   gdlib::gmsalloc::TVector<char> Arena;      // all labels, each terminated by '\0'
+   gdlib::gmsalloc::TVector<int64_t> Offsets; // entry number - 1 -> start of label in Arena
+   gdlib::gmsalloc::TVector<int> UserMaps;    // entry number - 1 -> user map (or -1)
+   gdlib::gmsalloc::TVector<uint32_t> Slots;  // hash table: entry number (0 means empty)
+   gdlib::gmsalloc::TVector<uint32_t> SlotHashes;// full hash value of the entry in the corresponding slot
+   uint32_t SlotMask {};
+   mutable int FMaxUELLength {};// length of the longest label, -1 when it has to be recomputed
+   TUELUserMapStatus FMapToUserStatus { TUELUserMapStatus::map_unknown };
+
+   static uint32_t Hash( const char *s );
+   [[nodiscard]] uint32_t FindSlot( const char *s, uint32_t HV ) const;
+   void InsertSlot( uint32_t EN, uint32_t HV );
+   void RemoveSlot( uint32_t EN );
+   void GrowSlots( size_t MinEntries );
+   int AppendEntry( const char *s, size_t slen, int mapping );
+
+public:
+   bool OneBased { true };// entries are numbered 1..size(), kept for compatibility with TUELTable
+   std::unique_ptr<TIntegerMapping> UsrUel2Ent {};// from user uelnr to table entry
+   TUELTableCompact();
+   ~TUELTableCompact() = default;
+   void Clear();
+   void SetCapacity( int n, size_t strBytes = 0 );
+   [[nodiscard]] int size() const;
+   [[nodiscard]] bool empty() const;
+   [[nodiscard]] int GetUserMap( int i ) const;
+   void SetUserMap( int EN, int N );
+   int NewUsrUel( int EN );
+   int AddUsrNew( const char *s, size_t slen );
+   int AddUsrIndxNew( const char *s, size_t slen, int UelNr );
+   [[nodiscard]] int GetMaxUELLength() const;
+   [[nodiscard]] int IndexOf( const char *s ) const;
+   int AddObject( const char *id, size_t idlen, int mapping );
+   int StoreObject( const char *id, size_t idlen, int mapping );
+   const char *operator[]( int index ) const;
+   void RenameEntry( int N, const char *s );
+   [[nodiscard]] int MemoryUsed() const;
+   void SaveToStream( gdlib::gmsstrm::TXStream &S );
+   void LoadFromStream( gdlib::gmsstrm::TXStream &S );
+   TUELUserMapStatus GetMapToUserStatus();
+   void ResetMapToUserStatus();
+};
+
+// Define GDX_COMPACT_UEL_TABLE (CMake option COMPACT_UEL_TABLE) to let TGXFileObj use the arena backed UEL table
+#if defined( GDX_COMPACT_UEL_TABLE )
+using UELTableImplChoice = TUELTableCompact;
+#else
+using UELTableImplChoice = TUELTable;
+#endif
+
 int MakeGoodExplText( char *s );
 
 struct TAcronym final {
@@ -298,6 +397,15 @@ class TAcronymList final
    bool useBatchAlloc {};
    gdlib::gmsobj::TXList<TAcronym> FList;
    gdlib::batchalloc::BatchAllocator<sizeof(TAcronym)> batchAlloc;
+   // open addressing indices by map number and by case-insensitive name,
+   // a slot holds entry index + 1 (0 = empty), the first entry wins for duplicates
+   std::vector<int> MapSlots, NameSlots;
+   bool NameSlotsValid {};
+   int LastMap {}, LastEntry { -1 };// last hit of FindEntry
+
+   void Reindex( int MinSlots );
+   void InsertMapSlot( int N );
+   void InsertNameSlot( int N );
 
 public:
    TAcronymList() = default;
@@ -307,6 +415,7 @@ public:
    int FindName( const char *Name );
    int AddEntry( const char *Name, const char *Text, int Map );
    void CheckEntry( int Map );
+   void SetNameAndText( int N, const char *Name, const char *Text );
    void SaveToStream( gdlib::gmsstrm::TXStream &S );
    void LoadFromStream( gdlib::gmsstrm::TXStream &S );
    int MemoryUsed();
@@ -314,6 +423,29 @@ public:
    TAcronym &operator[]( int Index );
 };
 
+// Error records of the current symbol (domain violations, duplicates, unsorted records) stored back to back,
+// keys followed by values, in a TGrowArrayFxd. At most Limit records are stored (no limit for Limit < 0),
+// further records are only counted.
+class TErrorList final
+{
+   int FDim, FDataSize, FKeyBytes, FLimit;
+   gdlib::gmsdata::TGrowArrayFxd<uint8_t> Recs;
+   int64_t FOverflow {};
+   // negative (unmapped) keys of the stored records per dimension
+   std::vector<gdlib::gmsobj::TBooleanBitArray> NegKeys;
+
+public:
+   TErrorList( int Dim, int DataSize, int Limit );
+   bool AddRecord( const int *Keys, const double *Vals );
+   [[nodiscard]] bool HasNegKey( int D, int EN ) const;
+   void GetRecord( int64_t N, int *Keys, double *Vals ) const;
+   int64_t GetRecords( int64_t First, int64_t Cnt, int *Keys, double *Vals, int ValStride ) const;
+   [[nodiscard]] int64_t GetCount() const;
+   [[nodiscard]] int64_t OverflowCount() const;
+   [[nodiscard]] int GetDimension() const;
+   [[nodiscard]] int64_t MemoryUsed() const;
+};
+
 class TFilterList final
 {
    gdlib::gmsobj::TXList<TDFilter> FList;
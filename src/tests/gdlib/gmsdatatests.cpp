@@ -28,6 +28,7 @@
 #include "tests/doctest.hpp"   // for ResultBuilder, REQUIRE_EQ
 #include <algorithm>   // for fill
 #include <array>       // for array
+#include <vector>      // for vector
 
 using namespace std::literals::string_literals;
 using namespace gdlib::gmsdata;
@@ -135,6 +136,72 @@ TEST_CASE( "Test sorting more elaborately" )
    }
 }
 
+TEST_CASE( "Test sorting records spread over several chunks" )
+{
+   // odd data size, more records than fit into one chunk
+   TTblGamsData<double> gdl { 2, sizeof( double ) * 3 };
+   constexpr int n { 50000 };
+   std::array<int, 2> keys {};
+   std::array<double, 3> vals {};
+   for( int i {}; i < n; i++ )
+   {
+      const int k { static_cast<int>( ( static_cast<int64_t>( i ) * 7919 ) % n ) };// permutation of 0..n-1
+      keys = { k / 100, k % 100 };
+      vals = { static_cast<double>( k ), -1.0 * k, 0.5 };
+      gdl.AddRecord( keys.data(), vals.data() );
+   }
+   REQUIRE_EQ( n, gdl.GetCount() );
+   gdl.Sort();
+   for( int i {}; i < n; i++ )
+   {
+      gdl.GetRecord( i, keys.data(), vals.data() );
+      REQUIRE_EQ( i / 100, keys[0] );
+      REQUIRE_EQ( i % 100, keys[1] );
+      REQUIRE_EQ( static_cast<double>( i ), vals[0] );
+      REQUIRE_EQ( -1.0 * i, gdl.GetDataPtr( i )[1] );
+   }
+   // sorted already, must not change anything
+   gdl.Sort();
+   gdl.GetKeys( n - 1, keys.data() );
+   REQUIRE_EQ( ( n - 1 ) % 100, keys[1] );
+}
+
+TEST_CASE( "Test TGrowArrayFxd with bulk operations and custom chunk size" )
+{
+   using TRec = std::array<int64_t, 3>;
+   // chunk size is rounded down to whole items and capped at MaxBufSize
+   TGrowArrayFxd<TRec> big { sizeof( TRec ), 100 * MaxBufSize };
+   REQUIRE_EQ( MaxBufSize / sizeof( TRec ) * sizeof( TRec ), big.GetChunkBytes() );
+   TGrowArrayFxd<TRec> ga { sizeof( TRec ), 1000 };
+   REQUIRE_EQ( 41 * sizeof( TRec ), ga.GetChunkBytes() );
+   REQUIRE_EQ( 0, ga.MemoryUsed() );
+   std::vector<TRec> recs( 1000 );
+   for( int64_t i {}; i < static_cast<int64_t>( recs.size() ); i++ )
+      recs[i] = { i, -i, 2 * i };
+   ga.AddItem( &recs.front() );
+   REQUIRE_EQ( 1, ga.AddItems( &recs[1], 998 ) );
+   ga.AddItem( &recs.back() );
+   REQUIRE_EQ( 1000, ga.GetCount() );
+   for( int64_t i {}; i < ga.GetCount(); i++ )
+      REQUIRE_EQ( recs[i], *ga[i] );
+   std::vector<TRec> out( 500 );
+   ga.CopyItems( 300, 500, out.data() );
+   REQUIRE( std::equal( out.begin(), out.end(), recs.begin() + 300 ) );
+   REQUIRE_GE( ga.MemoryUsed(), 1000 * static_cast<int64_t>( sizeof( TRec ) ) );
+   ga.Clear();
+   REQUIRE_EQ( 0, ga.GetCount() );
+   REQUIRE_EQ( 0, ga.MemoryUsed() );
+
+   TXIntList il;
+   il[20000] = 3;
+   REQUIRE_EQ( 20001, il.size() );
+   REQUIRE_EQ( 0, il[19999] );
+   REQUIRE_EQ( 20001, il.Add( 4 ) );
+   il.Exchange( 20000, 20001 );
+   REQUIRE_EQ( 4, il[20000] );
+   REQUIRE_EQ( 3, il[20001] );
+}
+
 TEST_SUITE_END();
 
 }
@@ -80,6 +80,56 @@ TEST_CASE( "Simple use TBooleanBitArray" )
    REQUIRE( bba.MemoryUsed() > oldMem );
 }
 
+TEST_CASE( "Counting, rank, select and bulk operations of TBooleanBitArray" )
+{
+   TBooleanBitArray a, b;
+   REQUIRE_EQ( 0, a.Count() );
+   REQUIRE_EQ( -1, a.Select( 0 ) );
+   std::vector<int> setBits;
+   for( int i {}; i < 3000; i += i < 200 ? 3 : 97 )
+   {
+      a.SetBit( i, true );
+      setBits.push_back( i );
+   }
+   REQUIRE_EQ( static_cast<int>( setBits.size() ), a.Count() );
+   for( int k {}; k < static_cast<int>( setBits.size() ); k++ )
+   {
+      REQUIRE_EQ( setBits[k], a.Select( k ) );
+      REQUIRE_EQ( k, a.Rank( setBits[k] ) );
+      REQUIRE_EQ( k + 1, a.Rank( setBits[k] + 1 ) );
+   }
+   REQUIRE_EQ( -1, a.Select( a.Count() ) );
+   REQUIRE_EQ( a.Count(), a.Rank( 100000 ) );
+
+   // clearing a bit must clear exactly that bit
+   a.SetBit( 3, false );
+   REQUIRE_FALSE( a.GetBit( 3 ) );
+   REQUIRE( a.GetBit( 0 ) );
+   REQUIRE( a.GetBit( 6 ) );
+   REQUIRE_EQ( static_cast<int>( setBits.size() ) - 1, a.Count() );
+   REQUIRE_EQ( 6, a.Select( 1 ) );
+
+   for( int i {}; i < 5000; i += 2 )
+      b.SetBit( i, true );
+   TBooleanBitArray c;
+   c.OrWith( a );
+   c.AndWith( b );
+   TBooleanBitArray d;
+   d.OrWith( a );
+   d.AndNotWith( b );
+   TBooleanBitArray e;
+   e.OrWith( a );
+   e.OrWith( b );
+   for( int i {}; i < 5100; i++ )
+   {
+      REQUIRE_EQ( a.GetBit( i ) && b.GetBit( i ), c.GetBit( i ) );
+      REQUIRE_EQ( a.GetBit( i ) && !b.GetBit( i ), d.GetBit( i ) );
+      REQUIRE_EQ( a.GetBit( i ) || b.GetBit( i ), e.GetBit( i ) );
+   }
+   REQUIRE_EQ( c.Count() + d.Count(), a.Count() );
+   REQUIRE_EQ( b.GetHighIndex(), e.GetHighIndex() );
+}
+
 TEST_CASE( "Simple use of TXList" )
 {
    TXList<int> lst;
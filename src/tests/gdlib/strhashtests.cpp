@@ -58,6 +58,80 @@ TEST_CASE( "Adding some set element names that are mapped to numbers" )
    runTest<TXStrHashList<int>>( nums );
 }
 
+TEST_CASE( "Case folding hash and lookup of long and mixed case strings" )
+{
+   const std::string lower { "abcdefghijklmnopqrstuvwxyz_0123456789@[`{~" },
+           upper { "ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789@[`{~" };
+   // every prefix length exercises the 16 byte steps and the tail handling
+   for( size_t len {}; len <= lower.length(); len++ )
+   {
+      REQUIRE_EQ( HashText<true>( lower.c_str(), len ), HashText<true>( upper.c_str(), len ) );
+      if( len > 0 && lower[len - 1] != upper[len - 1] )
+         REQUIRE_NE( HashText<false>( lower.c_str(), len ), HashText<false>( upper.c_str(), len ) );
+      if( len > 0 )
+         REQUIRE_NE( HashText<true>( lower.c_str(), len ), HashText<true>( lower.c_str(), len - 1 ) );
+   }
+   // bytes outside of ASCII are not folded
+   REQUIRE_NE( HashText<true>( "\xe4", 1 ), HashText<true>( "\xc4", 1 ) );
+
+   TXStrHashList<int> ci;
+   TXCSStrHashList<int> cs;
+   const int n { 5000 };// enough to trigger several rehashes
+   for( int i {}; i < n; i++ )
+   {
+      const std::string s { "Element_with_a_longer_name_" + std::to_string( i ) };
+      REQUIRE_EQ( i, ci.AddObject( s.c_str(), s.length(), i ) );
+      REQUIRE_EQ( i, cs.AddObject( s.c_str(), s.length(), i ) );
+   }
+   for( int i {}; i < n; i++ )
+   {
+      const std::string s { "ELEMENT_WITH_A_LONGER_NAME_" + std::to_string( i ) };
+      REQUIRE_EQ( i, ci.IndexOf( s.c_str() ) );
+      REQUIRE_EQ( -1, cs.IndexOf( s.c_str() ) );
+   }
+   ci.RenameEntry( 42, "renamed" );
+   REQUIRE_EQ( 42, ci.IndexOf( "RENAMED" ) );
+   REQUIRE_EQ( -1, ci.IndexOf( "Element_with_a_longer_name_42" ) );
+}
+
+TEST_CASE( "Lookups and renames while the hash table grows incrementally" )
+{
+   TXStrHashList<int> shl;
+   shl.OneBased = true;
+   auto name = []( int i ) { return "uel" + std::to_string( i ); };
+   // the first growth step starts with entry 1025, its migration takes a few hundred more inserts
+   for( int i { 1 }; i <= 1030; i++ )
+   {
+      const std::string s { name( i ) };
+      REQUIRE_EQ( i, shl.AddObject( s.c_str(), s.length(), i ) );
+   }
+   for( int i { 1 }; i <= 1030; i++ )
+   {
+      const std::string s { name( i ) };
+      REQUIRE_EQ( i, shl.IndexOf( s.c_str() ) );
+      // adding an existing entry neither duplicates it nor moves the migration forward
+      REQUIRE_EQ( i, shl.AddObject( s.c_str(), s.length(), -1 ) );
+   }
+   for( int i { 1 }; i <= 1030; i += 7 )
+   {
+      const std::string s { "renamed" + std::to_string( i ) };
+      shl.RenameEntry( i, s.c_str() );
+   }
+   for( int i { 1031 }; i <= 3000; i++ )
+   {
+      const std::string s { name( i ) };
+      REQUIRE_EQ( i, shl.AddObject( s.c_str(), s.length(), i ) );
+   }
+   REQUIRE_EQ( 3000, shl.Count() );
+   for( int i { 1 }; i <= 3000; i++ )
+   {
+      const std::string s { i <= 1030 && ( i - 1 ) % 7 == 0 ? "RENAMED" + std::to_string( i ) : name( i ) };
+      REQUIRE_EQ( i, shl.IndexOf( s.c_str() ) );
+      REQUIRE_EQ( i, *shl.GetObject( i ) );
+   }
+   REQUIRE_EQ( -1, shl.IndexOf( "uel1" ) );
+}
+
 TEST_SUITE_END();
 
 }
@@ -101,6 +101,22 @@ TEST_CASE( "Convert double to string" )
    REQUIRE_EQ("1E-10", DblToStr(1e-10));
    REQUIRE_EQ("1E15", DblToStr(1e15+1));
    REQUIRE_EQ("0.000101", DblToStr(1.01e-4));
+   REQUIRE_EQ("1000000000000000", DblToStr(999999999999999.9));
+   REQUIRE_EQ("1E-4", DblToStr(9.999999999999999e-5));
+   REQUIRE_EQ("-1.5E-300", DblToStr(-1.5e-300));
+   REQUIRE_EQ("4.94065645841247E-324", DblToStr(5e-324));
+   REQUIRE_EQ("1.79769313486232E308", DblToStr(1.7976931348623157e308));
+   REQUIRE_EQ("0.3", DblToStr(0.1 + 0.2));
+   REQUIRE_EQ("-12,5", DblToStrSep(-12.5, ','));
+   REQUIRE_EQ("1.5E20", DblToStrSep(1.5e20, ','));
+
+   // Ties at the 16th digit are decided by the exact conversion
+   REQUIRE_EQ("1E15", DblToStr(1000000000000005.0));
+   REQUIRE_EQ("1.00000000000002E15", DblToStr(1000000000000015.0));
+   REQUIRE_EQ(5, DblToStr(1e-10, buf.data()));
+   REQUIRE(!std::strcmp(buf.data(), "1E-10"));
+   REQUIRE_EQ(4, DblToStr(1e15+5, buf.data()));
+   REQUIRE(!std::strcmp(buf.data(), "1E15"));
 }
 
 TEST_CASE( "Test generating blank string of specified length" )
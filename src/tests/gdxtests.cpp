@@ -2653,6 +2653,462 @@ TEST_CASE( "Test option to map acronym indices to NaN" )
    fs::remove(fn);
 }
 
+TEST_CASE( "Test writing and reading files with the major index in a trailer" )
+{
+   const std::string fn { "footerindex.gdx" };
+   constexpr int cardinality { 100 };
+   TgdxValues vals {};
+   StrIndexBuffers keys;
+   for( const bool compress: { false, true } )
+   {
+      basicTest( [&]( TGXFileObj &pgx ) {
+         REQUIRE_FALSE( pgx.gdxFooterIndex() );
+         pgx.gdxFooterIndexSet( true );
+         REQUIRE( pgx.gdxFooterIndex() );
+         pgx.gdxAutoConvert( 0 );
+         int ErrNr;
+         REQUIRE( pgx.gdxOpenWriteEx( fn.c_str(), "gdxtest", compress ? 1 : 0, ErrNr ) );
+         REQUIRE( pgx.gdxDataWriteStrStart( "i", "set", 1, dt_set, 0 ) );
+         for( int i {}; i < cardinality; i++ )
+         {
+            keys.front() = "i"s + std::to_string( i + 1 );
+            REQUIRE( pgx.gdxDataWriteStr( keys.cptrs(), vals.data() ) );
+         }
+         REQUIRE( pgx.gdxDataWriteDone() );
+         REQUIRE( pgx.gdxAcronymAdd( "myacr", "my acronym", 3 ) >= 0 );
+         REQUIRE_FALSE( pgx.gdxClose() );
+      } );
+      testRead( fn, [&]( TGXFileObj &pgx ) {
+         int numRecs, dimFrst;
+         REQUIRE_EQ( 1, pgx.gdxAcronymCount() );
+         REQUIRE( pgx.gdxDataReadStrStart( 1, numRecs ) );
+         REQUIRE_EQ( cardinality, numRecs );
+         for( int i {}; i < cardinality; i++ )
+         {
+            REQUIRE( pgx.gdxDataReadStr( keys.ptrs(), vals.data(), dimFrst ) );
+            REQUIRE_EQ( "i"s + std::to_string( i + 1 ), keys.front().str() );
+         }
+         REQUIRE( pgx.gdxDataReadDone() );
+      } );
+      // appending keeps the trailer at the very end
+      basicTest( [&]( TGXFileObj &pgx ) {
+         int ErrNr;
+         pgx.gdxAutoConvert( 0 );
+         REQUIRE( pgx.gdxOpenAppend( fn.c_str(), "gdxtest", ErrNr ) );
+         REQUIRE( pgx.gdxDataWriteStrStart( "j", "", 1, dt_set, 0 ) );
+         keys.front() = "j1"s;
+         REQUIRE( pgx.gdxDataWriteStr( keys.cptrs(), vals.data() ) );
+         REQUIRE( pgx.gdxDataWriteDone() );
+         REQUIRE_FALSE( pgx.gdxClose() );
+      } );
+      testRead( fn, [&]( TGXFileObj &pgx ) {
+         int numSyms, numUels;
+         REQUIRE( pgx.gdxSystemInfo( numSyms, numUels ) );
+         REQUIRE_EQ( 2, numSyms );
+         REQUIRE_EQ( cardinality + 1, numUels );
+      } );
+      fs::remove( fn );
+   }
+}
+
+TEST_CASE( "Test symbol fingerprints and raw data bytes" )
+{
+   const std::array<std::string, 4> fns { "fingerprint1.gdx", "fingerprint2.gdx", "fingerprint3.gdx", "fingerprint4.gdx" };
+   StrIndexBuffers keys;
+   // reversed registers the UELs and set texts in reverse order, so all numbers differ
+   auto writeFile = [&]( const std::string &fn, bool fingerprints, bool reversed, bool compress, double lastValue ) {
+      basicTest( [&]( TGXFileObj &pgx ) {
+         pgx.gdxStoreFingerprintsSet( fingerprints );
+         REQUIRE_EQ( fingerprints, pgx.gdxStoreFingerprints() );
+         pgx.gdxAutoConvert( 0 );
+         int ErrNr;
+         REQUIRE( pgx.gdxOpenWriteEx( fn.c_str(), "gdxtest", compress ? 1 : 0, ErrNr ) );
+         TgdxValues vals {};
+         int txtNr;
+         if( reversed )
+         {
+            REQUIRE( pgx.gdxUELRegisterStrStart() );
+            for( int i { 3 }; i >= 1; i-- )
+               REQUIRE( pgx.gdxUELRegisterStr( ( "i"s + std::to_string( i ) ).c_str(), txtNr ) );
+            REQUIRE( pgx.gdxUELRegisterDone() );
+            REQUIRE( pgx.gdxAddSetText( "second", txtNr ) );
+         }
+         REQUIRE( pgx.gdxDataWriteStrStart( "i", "set", 1, dt_set, 0 ) );
+         for( int i { 1 }; i <= 3; i++ )
+         {
+            keys.front() = "i"s + std::to_string( i );
+            REQUIRE( pgx.gdxAddSetText( i == 1 ? "first" : "second", txtNr ) );
+            vals[GMS_VAL_LEVEL] = i == 3 ? 0 : txtNr;
+            REQUIRE( pgx.gdxDataWriteStr( keys.cptrs(), vals.data() ) );
+         }
+         REQUIRE( pgx.gdxDataWriteDone() );
+         REQUIRE( pgx.gdxAddAlias( "i", "ii" ) );
+         REQUIRE( pgx.gdxDataWriteStrStart( "p", "parameter", 2, dt_par, 0 ) );
+         double v {};
+         for( int i { 1 }; i <= 3; i++ )
+         {
+            for( int j { 1 }; j <= 3; j++ )
+            {
+               keys[0] = "i"s + std::to_string( i );
+               keys[1] = "i"s + std::to_string( j );
+               vals[GMS_VAL_LEVEL] = i == 3 && j == 3 ? lastValue : j == 2 ? GMS_SV_EPS : v++;
+               REQUIRE( pgx.gdxDataWriteStr( keys.cptrs(), vals.data() ) );
+            }
+         }
+         REQUIRE( pgx.gdxDataWriteDone() );
+         REQUIRE_FALSE( pgx.gdxClose() );
+      } );
+   };
+   writeFile( fns[0], true, false, false, 42.0 );
+   writeFile( fns[1], true, true, true, 42.0 );
+   writeFile( fns[2], true, false, false, 43.0 );
+   writeFile( fns[3], false, false, false, 42.0 );
+
+   std::array<std::array<std::string, 3>, 4> fingerprints, bytes;
+   for( int f {}; f < 4; f++ )
+   {
+      testRead( fns[f], [&]( TGXFileObj &pgx ) {
+         for( int SyNr { 1 }; SyNr <= 3; SyNr++ )
+         {
+            std::array<char, GMS_SSSIZE> buf {};
+            REQUIRE_EQ( f != 3, pgx.gdxSymbolFingerprint( SyNr, buf.data() ) );
+            fingerprints[f][SyNr - 1] = buf.data();
+            REQUIRE_EQ( f != 3 ? 16 : 0, fingerprints[f][SyNr - 1].length() );
+            // small ranges, so that a symbol takes several calls
+            for( int n; ( n = pgx.gdxSymbolDataBytes( SyNr, static_cast<int64_t>( bytes[f][SyNr - 1].size() ), 5, buf.data() ) ) > 0; )
+               bytes[f][SyNr - 1].append( buf.data(), n );
+            REQUIRE_FALSE( bytes[f][SyNr - 1].empty() );
+         }
+         std::array<char, GMS_SSSIZE> buf {};
+         REQUIRE_FALSE( pgx.gdxSymbolFingerprint( 0, buf.data() ) );
+         REQUIRE_EQ( -1, pgx.gdxSymbolDataBytes( 4, 0, 5, buf.data() ) );
+         REQUIRE_EQ( 0, pgx.gdxSymbolDataBytes( 3, static_cast<int64_t>( bytes[f][2].size() ), 5, buf.data() ) );
+         // a read in progress is not disturbed
+         int NrRecs, DimFrst;
+         REQUIRE( pgx.gdxDataReadRawStart( 3, NrRecs ) );
+         REQUIRE_EQ( -1, pgx.gdxSymbolDataBytes( 3, 0, 5, buf.data() ) );
+         TgdxUELIndex keyInts;
+         TgdxValues vals;
+         for( int N {}; N < NrRecs; N++ )
+            REQUIRE( pgx.gdxDataReadRaw( keyInts.data(), vals.data(), DimFrst ) );
+         REQUIRE( pgx.gdxDataReadDone() );
+         REQUIRE_EQ( 5, pgx.gdxSymbolDataBytes( 3, 0, 5, buf.data() ) );
+      } );
+   }
+   // alias ii gives the same results as set i
+   for( int f {}; f < 4; f++ )
+   {
+      REQUIRE_EQ( fingerprints[f][0], fingerprints[f][1] );
+      REQUIRE_EQ( bytes[f][0], bytes[f][1] );
+   }
+   // independent of UEL numbering, set text numbering and compression
+   REQUIRE_EQ( fingerprints[0], fingerprints[1] );
+   REQUIRE_NE( bytes[0][0], bytes[1][0] );
+   // a changed value changes the fingerprint and the data of that symbol only
+   REQUIRE_EQ( fingerprints[0][0], fingerprints[2][0] );
+   REQUIRE_NE( fingerprints[0][2], fingerprints[2][2] );
+   REQUIRE_EQ( bytes[0][0], bytes[2][0] );
+   REQUIRE_EQ( bytes[0][2].size(), bytes[2][2].size() );
+   REQUIRE_NE( bytes[0][2], bytes[2][2] );
+   // the stored data does not depend on the fingerprint option
+   REQUIRE_EQ( bytes[0], bytes[3] );
+
+   // appending keeps the fingerprints, renaming a UEL drops them
+   basicTest( [&]( TGXFileObj &pgx ) {
+      int ErrNr;
+      pgx.gdxAutoConvert( 0 );
+      REQUIRE( pgx.gdxOpenAppend( fns[0].c_str(), "gdxtest", ErrNr ) );
+      REQUIRE( pgx.gdxDataWriteStrStart( "s", "scalar", 0, dt_par, 0 ) );
+      TgdxValues vals {};
+      REQUIRE( pgx.gdxDataWriteStr( keys.cptrs(), vals.data() ) );
+      REQUIRE( pgx.gdxDataWriteDone() );
+      REQUIRE_FALSE( pgx.gdxClose() );
+   } );
+   testRead( fns[0], [&]( TGXFileObj &pgx ) {
+      std::array<char, GMS_SSSIZE> buf {};
+      REQUIRE( pgx.gdxSymbolFingerprint( 3, buf.data() ) );
+      REQUIRE_EQ( fingerprints[0][2], std::string { buf.data() } );
+      REQUIRE_FALSE( pgx.gdxSymbolFingerprint( 4, buf.data() ) );
+      REQUIRE_FALSE( pgx.gdxRenameUEL( "i1", "i0" ) );
+      REQUIRE_FALSE( pgx.gdxSymbolFingerprint( 3, buf.data() ) );
+   } );
+   for( const auto &fn: fns )
+      fs::remove( fn );
+}
+
+TEST_CASE( "Test 64 bit record counts and file version" )
+{
+   const std::string fn { "recordcount64.gdx" };
+   constexpr int cardinality { 10 };
+   TgdxValues vals {};
+   StrIndexBuffers keys;
+   // regular files keep version 7 (32 bit counts), append-only files are written as version 8 (64 bit counts)
+   for( const bool footerIndex: { false, true } )
+   {
+      const int expectedVersion { footerIndex ? 8 : 7 };
+      basicTest( [&]( TGXFileObj &pgx ) {
+         int ErrNr, FileVer, ComprLev;
+         pgx.gdxFooterIndexSet( footerIndex );
+         pgx.gdxAutoConvert( 0 );
+         REQUIRE( pgx.gdxOpenWrite( fn.c_str(), "gdxtest", ErrNr ) );
+         REQUIRE( pgx.gdxFileInfo( FileVer, ComprLev ) );
+         REQUIRE_EQ( expectedVersion, FileVer );
+         REQUIRE( pgx.gdxDataWriteStrStart( "i", "set i", 1, dt_set, 0 ) );
+         for( int i {}; i < cardinality; i++ )
+         {
+            keys.front() = "i"s + std::to_string( i + 1 );
+            REQUIRE( pgx.gdxDataWriteStr( keys.cptrs(), vals.data() ) );
+         }
+         REQUIRE( pgx.gdxDataWriteDone() );
+         REQUIRE_FALSE( pgx.gdxClose() );
+      } );
+      testRead( fn, [&]( TGXFileObj &pgx ) {
+         int FileVer, ComprLev, userInfo, numRecs;
+         int64_t numRecs64;
+         char explText[GMS_SSSIZE];
+         REQUIRE( pgx.gdxFileInfo( FileVer, ComprLev ) );
+         REQUIRE_EQ( expectedVersion, FileVer );
+         REQUIRE( pgx.gdxSymbolInfoX64( 1, numRecs64, userInfo, explText ) );
+         REQUIRE_EQ( cardinality, numRecs64 );
+         REQUIRE_EQ( "set i"s, explText );
+         REQUIRE( pgx.gdxSymbolInfoX( 1, numRecs, userInfo, explText ) );
+         REQUIRE_EQ( cardinality, numRecs );
+         REQUIRE( pgx.gdxDataReadRawStart64( 1, numRecs64 ) );
+         REQUIRE_EQ( cardinality, numRecs64 );
+         REQUIRE( pgx.gdxDataReadDone() );
+         REQUIRE( pgx.gdxDataReadMapStart64( 1, numRecs64 ) );
+         REQUIRE_EQ( cardinality, numRecs64 );
+         REQUIRE( pgx.gdxDataReadDone() );
+         REQUIRE( pgx.gdxDataReadStrStart64( 1, numRecs64 ) );
+         REQUIRE_EQ( cardinality, numRecs64 );
+         REQUIRE( pgx.gdxDataReadDone() );
+         REQUIRE_FALSE( pgx.gdxDataReadRawStart64( 2, numRecs64 ) );
+         REQUIRE_EQ( -1, numRecs64 );
+      } );
+      fs::remove( fn );
+   }
+}
+
+TEST_CASE( "Test limiting and bulk reading the error list" )
+{
+   const std::string fn { "errorlimit.gdx" };
+   basicTest( [&]( TGXFileObj &pgx ) {
+      int ErrNr;
+      REQUIRE_EQ( 11, pgx.gdxDataErrorLimit() );
+      REQUIRE( pgx.gdxOpenWrite( fn.c_str(), "gdxtest", ErrNr ) );
+      TgdxValues vals {};
+      std::array<int, 2> keys {};
+      for( const int limit: { 5, -1 } )
+      {
+         pgx.gdxDataErrorLimitSet( limit );
+         REQUIRE( pgx.gdxDataWriteRawStart( ( "p"s + std::to_string( limit + 1 ) ).c_str(), "", 2, dt_par, 0 ) );
+         // descending keys, all records after the first one are errors
+         for( int i { 30 }; i >= 1; i-- )
+         {
+            keys = { 1, i };
+            vals[GMS_VAL_LEVEL] = i;
+            REQUIRE_EQ( i == 30, pgx.gdxDataWriteRaw( keys.data(), vals.data() ) );
+         }
+         pgx.gdxDataWriteDone();
+         const int stored { limit < 0 ? 29 : limit };
+         REQUIRE_EQ( stored, pgx.gdxDataErrorCount() );
+         REQUIRE_EQ( 29 - stored, pgx.gdxDataErrorOverflowCount() );
+         std::vector<int> keysOut( 2 * 40 );
+         std::vector<double> valsOut( GMS_VAL_MAX * 40 );
+         REQUIRE_EQ( stored - 1, pgx.gdxDataErrorRecords( 2, 40, keysOut.data(), valsOut.data() ) );
+         for( int n {}; n < stored - 1; n++ )
+         {
+            REQUIRE_EQ( 1, keysOut[2 * n] );
+            REQUIRE_EQ( 28 - n, keysOut[2 * n + 1] );
+            REQUIRE_EQ( 28 - n, valsOut[GMS_VAL_MAX * n + GMS_VAL_LEVEL] );
+            REQUIRE( pgx.gdxDataErrorRecordX( n + 2, keys.data(), vals.data() ) );
+            REQUIRE_EQ( keysOut[2 * n + 1], keys[1] );
+         }
+         REQUIRE_FALSE( pgx.gdxDataErrorRecords( stored + 1, 1, keysOut.data(), valsOut.data() ) );
+      }
+      pgx.gdxGetLastError();
+      pgx.gdxClose();
+   } );
+   fs::remove( fn );
+}
+
+#if !defined( GXFILE_CPPWRAP )
+// the allocation hook is only part of the C++ API
+struct TAllocCounter {
+   int64_t Allocs {}, Frees {}, Bytes {};
+};
+
+static void *countingAlloc( const size_t Size, const size_t Alignment, void *Uptr )
+{
+   auto &cnt { *static_cast<TAllocCounter *>( Uptr ) };
+   cnt.Allocs++;
+   cnt.Bytes += static_cast<int64_t>( Size );
+   if( Alignment > 64 ) return nullptr;
+   return ::operator new( Size, std::align_val_t { 64 }, std::nothrow );
+}
+
+static void countingFree( void *P, const size_t Size, void *Uptr )
+{
+   auto &cnt { *static_cast<TAllocCounter *>( Uptr ) };
+   cnt.Frees++;
+   cnt.Bytes -= static_cast<int64_t>( Size );
+   ::operator delete( P, std::align_val_t { 64 } );
+}
+
+TEST_CASE( "Test installing a custom allocator" )
+{
+   const std::string fn { "customalloc.gdx" };
+   TAllocCounter cnt;
+   // both procedures or none
+   REQUIRE_FALSE( gdxSetAllocator( countingAlloc, nullptr, &cnt ) );
+   REQUIRE( gdxSetAllocator( countingAlloc, countingFree, &cnt ) );
+   TgdxValues vals {};
+   StrIndexBuffers keys;
+   basicTest( [&]( TGXFileObj &pgx ) {
+      int ErrNr;
+      REQUIRE( pgx.gdxOpenWrite( fn.c_str(), "gdxtest", ErrNr ) );
+      REQUIRE( pgx.gdxDataWriteStrStart( "i", "set i", 1, dt_set, 0 ) );
+      for( int i {}; i < 1000; i++ )
+      {
+         keys.front() = "i"s + std::to_string( i + 1 );
+         REQUIRE( pgx.gdxDataWriteStr( keys.cptrs(), vals.data() ) );
+      }
+      REQUIRE( pgx.gdxDataWriteDone() );
+      REQUIRE_FALSE( pgx.gdxClose() );
+   } );
+   REQUIRE_GT( cnt.Allocs, 0 );
+   REQUIRE_EQ( cnt.Allocs, cnt.Frees );
+   REQUIRE_EQ( 0, cnt.Bytes );
+   // blocks allocated with the counting allocator are returned to it after switching back
+   void *P { gdlib::gmsalloc::Allocate( 100 ) };
+   REQUIRE( gdxSetAllocator( nullptr, nullptr, nullptr ) );
+   gdlib::gmsalloc::Free( P );
+   REQUIRE_EQ( cnt.Allocs, cnt.Frees );
+   REQUIRE_EQ( 0, cnt.Bytes );
+   const int64_t allocs { cnt.Allocs };
+   testRead( fn, [&]( TGXFileObj &pgx ) {
+      int numRecs;
+      REQUIRE( pgx.gdxDataReadStrStart( 1, numRecs ) );
+      REQUIRE_EQ( 1000, numRecs );
+      REQUIRE( pgx.gdxDataReadDone() );
+   } );
+   REQUIRE_EQ( allocs, cnt.Allocs );
+   fs::remove( fn );
+
+   // switching back and forth between hooks, as per tenant or phase, reuses the installed ones
+   std::array<TAllocCounter, 2> tenants;
+   std::vector<void *> blocks;
+   for( int i {}; i < 1000; i++ )
+   {
+      REQUIRE( gdxSetAllocator( countingAlloc, countingFree, &tenants[i % 2] ) );
+      blocks.push_back( gdlib::gmsalloc::Allocate( 16 ) );
+   }
+   REQUIRE( gdxSetAllocator( nullptr, nullptr, nullptr ) );
+   REQUIRE_EQ( 500, tenants[0].Allocs );
+   REQUIRE_EQ( 500, tenants[1].Allocs );
+   for( void *P: blocks )
+      gdlib::gmsalloc::Free( P );
+   for( const auto &tenant: tenants )
+   {
+      REQUIRE_EQ( tenant.Allocs, tenant.Frees );
+      REQUIRE_EQ( 0, tenant.Bytes );
+   }
+}
+#endif
+
+TEST_CASE( "Test header-only open deferring UEL, set text and acronym sections" )
+{
+   const std::string fn { "headeronly.gdx" };
+   TgdxValues vals {};
+   StrIndexBuffers keys;
+   testWrite( fn, [&]( TGXFileObj &pgx ) {
+      REQUIRE( pgx.gdxAcronymAdd( "myacr", "my acronym", 7 ) >= 0 );
+      REQUIRE( pgx.gdxDataWriteStrStart( "i", "set i", 1, dt_set, 0 ) );
+      int txtNr;
+      REQUIRE( pgx.gdxAddSetText( "text for i2", txtNr ) );
+      for( int i {}; i < 3; i++ )
+      {
+         keys.front() = "i"s + std::to_string( i + 1 );
+         vals[GMS_VAL_LEVEL] = i == 1 ? txtNr : 0;
+         REQUIRE( pgx.gdxDataWriteStr( keys.cptrs(), vals.data() ) );
+      }
+      REQUIRE( pgx.gdxDataWriteDone() );
+   } );
+   for( const int readMode: { 2, 3 } )
+   {
+      basicTest( [&]( TGXFileObj &pgx ) {
+         int ErrNr;
+         REQUIRE( pgx.gdxOpenReadEx( fn.c_str(), readMode, ErrNr ) );
+         REQUIRE_FALSE( ErrNr );
+         int numSyms, numUels;
+         REQUIRE( pgx.gdxSystemInfo( numSyms, numUels ) );
+         REQUIRE_EQ( 1, numSyms );
+         REQUIRE_EQ( 3, numUels );
+         int recCnt, userInfo;
+         char explTxt[GMS_SSSIZE];
+         REQUIRE( pgx.gdxSymbolInfoX( 1, recCnt, userInfo, explTxt ) );
+         REQUIRE_EQ( 3, recCnt );
+         REQUIRE_EQ( "set i"s, explTxt );
+         // the universe reports the UEL count of the header before the UELs are loaded
+         REQUIRE( pgx.gdxSymbolInfoX( 0, recCnt, userInfo, explTxt ) );
+         REQUIRE_EQ( 3, recCnt );
+         REQUIRE_EQ( "Universe"s, explTxt );
+         // acronyms are loaded on their own
+         REQUIRE_EQ( 1, pgx.gdxAcronymCount() );
+         REQUIRE_EQ( 3, numUels );
+         char uel[GMS_SSSIZE];
+         int uelMap;
+         REQUIRE( pgx.gdxUMUelGet( 2, uel, uelMap ) );
+         REQUIRE_EQ( "i2"s, uel );
+         REQUIRE( pgx.gdxSymbolInfoX( 0, recCnt, userInfo, explTxt ) );
+         REQUIRE_EQ( 3, recCnt );
+         char txt[GMS_SSSIZE];
+         int node;
+         REQUIRE_EQ( readMode == 2, (bool) pgx.gdxGetElemText( 1, txt, node ) );
+         if( readMode == 2 ) REQUIRE_EQ( "text for i2"s, txt );
+         int numRecs, dimFrst;
+         REQUIRE( pgx.gdxDataReadStrStart( 1, numRecs ) );
+         REQUIRE_EQ( 3, numRecs );
+         for( int i {}; i < 3; i++ )
+         {
+            REQUIRE( pgx.gdxDataReadStr( keys.ptrs(), vals.data(), dimFrst ) );
+            REQUIRE_EQ( "i"s + std::to_string( i + 1 ), keys.front().str() );
+         }
+         REQUIRE( pgx.gdxDataReadDone() );
+         pgx.gdxClose();
+      } );
+   }
+   // data reading triggers loading of the deferred sections too
+   basicTest( [&]( TGXFileObj &pgx ) {
+      int ErrNr, numRecs, dimFrst;
+      REQUIRE( pgx.gdxOpenReadEx( fn.c_str(), 2, ErrNr ) );
+      REQUIRE( pgx.gdxDataReadStrStart( 1, numRecs ) );
+      REQUIRE( pgx.gdxDataReadStr( keys.ptrs(), vals.data(), dimFrst ) );
+      REQUIRE_EQ( "i1"s, keys.front().str() );
+      REQUIRE( pgx.gdxDataReadDone() );
+      REQUIRE_EQ( 1, pgx.gdxAcronymCount() );
+      pgx.gdxClose();
+   } );
+   // so do the UEL and set text queries and additions
+   basicTest( [&]( TGXFileObj &pgx ) {
+      int ErrNr, uelCnt, highMap, txtNr, node;
+      REQUIRE( pgx.gdxOpenReadEx( fn.c_str(), 2, ErrNr ) );
+      REQUIRE( pgx.gdxUMUelInfo( uelCnt, highMap ) );
+      REQUIRE_EQ( 3, uelCnt );
+      pgx.gdxClose();
+      REQUIRE( pgx.gdxOpenReadEx( fn.c_str(), 2, ErrNr ) );
+      REQUIRE( pgx.gdxAddSetText( "another text", txtNr ) );
+      REQUIRE_EQ( 2, txtNr );
+      char txt[GMS_SSSIZE];
+      REQUIRE( pgx.gdxGetElemText( 1, txt, node ) );
+      REQUIRE_EQ( "text for i2"s, txt );
+      REQUIRE( pgx.gdxGetElemText( 2, txt, node ) );
+      REQUIRE_EQ( "another text"s, txt );
+      pgx.gdxClose();
+   } );
+   fs::remove( fn );
+}
+
 TEST_CASE( "Test writing in raw mode with known UEL index bounds" )
 {
    const std::string fn {"narrowKeys.gdx"};
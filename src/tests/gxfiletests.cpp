@@ -107,6 +107,220 @@ TEST_CASE( "Test TIntegerMapping" )
    REQUIRE_EQ( 5, im.GetMapping( 3 ) );
 }
 
+TEST_CASE( "Test sparse TIntegerMapping" )
+{
+   TIntegerMapping im;
+   im.SetMapping( 7, 1 );
+   // a few scattered high indices must not allocate the whole range
+   im.SetMapping( 40000000, 2 );
+   REQUIRE( im.IsPaged() );
+   im.SetMapping( 30000000, 3 );
+   REQUIRE_LT( im.MemoryUsed(), 1024 * 1024 );
+   REQUIRE_EQ( 40000000, im.GetHighestIndex() );
+   REQUIRE_EQ( 1, im.GetMapping( 7 ) );
+   REQUIRE_EQ( 3, im.GetMapping( 30000000 ) );
+   REQUIRE_EQ( 2, im.GetMapping( 40000000 ) );
+   REQUIRE_EQ( -1, im.GetMapping( 30000001 ) );
+   REQUIRE_EQ( -1, im.GetMapping( 50000000 ) );
+   REQUIRE_EQ( 7, im.NextMapped( 0 ) );
+   REQUIRE_EQ( 30000000, im.NextMapped( 8 ) );
+   REQUIRE_EQ( 40000000, im.NextMapped( 30000001 ) );
+   REQUIRE_EQ( -1, im.NextMapped( 40000001 ) );
+
+   // using a quarter of the entries switches back to the flat array
+   TIntegerMapping im2;
+   im2.SetMapping( 1 << 20, 0 );
+   REQUIRE( im2.IsPaged() );
+   for( int N {}; N < ( 1 << 20 ) && im2.IsPaged(); N += 2 )
+      im2.SetMapping( N, N );
+   REQUIRE_FALSE( im2.IsPaged() );
+   for( int N {}; N < 4096 * 64; N += 4096 )
+      REQUIRE_EQ( N, im2.GetMapping( N ) );
+   REQUIRE_EQ( -1, im2.GetMapping( 1 ) );
+   REQUIRE_EQ( 0, im2.GetMapping( 1 << 20 ) );
+   REQUIRE_EQ( 2, im2.NextMapped( 1 ) );
+   REQUIRE_EQ( 1 << 20, im2.GetHighestIndex() );
+
+   // one index per page in ascending order must not switch at every growth
+   TIntegerMapping im3;
+   int switches {};
+   bool paged {};
+   for( int N {}; N < 20000; N++ )
+   {
+      im3.SetMapping( N * 4096, N );
+      if( im3.IsPaged() != paged )
+      {
+         paged = im3.IsPaged();
+         switches++;
+      }
+   }
+   REQUIRE_LE( switches, 1 );
+   REQUIRE( im3.IsPaged() );
+   REQUIRE_EQ( 19999, im3.GetMapping( 19999 * 4096 ) );
+   REQUIRE_EQ( -1, im3.GetMapping( 19999 * 4096 - 1 ) );
+
+   im.reset();
+   REQUIRE( im.empty() );
+   REQUIRE_FALSE( im.IsPaged() );
+   REQUIRE_EQ( -1, im.GetMapping( 7 ) );
+}
+
+TEST_CASE( "Test compact UEL table" )
+{
+   TUELTableCompact tbl;
+   REQUIRE( tbl.empty() );
+   REQUIRE_EQ( 1, tbl.AddObject( "i1", 2, -1 ) );
+   REQUIRE_EQ( 2, tbl.AddObject( "j1", 2, -1 ) );
+   REQUIRE_EQ( 1, tbl.AddObject( "I1", 2, -1 ) );
+   REQUIRE_EQ( 2, tbl.size() );
+   REQUIRE_EQ( 2, tbl.IndexOf( "J1" ) );
+   REQUIRE_EQ( -1, tbl.IndexOf( "k1" ) );
+   REQUIRE_EQ( "i1"s, tbl[1] );
+
+   // enough entries to force several rehashes
+   for( int i {}; i < 5000; i++ )
+   {
+      const auto uel { "uel"s + std::to_string( i ) };
+      REQUIRE_EQ( i + 3, tbl.AddObject( uel.c_str(), uel.length(), -1 ) );
+   }
+   REQUIRE_EQ( 5002, tbl.size() );
+   REQUIRE_EQ( 4999 + 3, tbl.IndexOf( "UEL4999" ) );
+   REQUIRE_EQ( 7, tbl.GetMaxUELLength() );
+
+   REQUIRE_EQ( -1, tbl.GetUserMap( 2 ) );
+   REQUIRE_EQ( 1, tbl.NewUsrUel( 2 ) );
+   REQUIRE_EQ( 2, tbl.AddUsrNew( "i1", 2 ) );
+   REQUIRE_EQ( 1, tbl.AddUsrNew( "j1", 2 ) );
+   REQUIRE_EQ( TUELUserMapStatus::map_unsorted, tbl.GetMapToUserStatus() );
+   REQUIRE_EQ( 2, tbl.UsrUel2Ent->GetMapping( 1 ) );
+   REQUIRE_EQ( -1, tbl.AddUsrIndxNew( "i1", 2, 7 ) );
+   REQUIRE_EQ( 7, tbl.AddUsrIndxNew( "new", 3, 7 ) );
+
+   tbl.RenameEntry( 1, "renamed_i1" );
+   REQUIRE_EQ( -1, tbl.IndexOf( "i1" ) );
+   REQUIRE_EQ( 1, tbl.IndexOf( "RENAMED_I1" ) );
+   REQUIRE_EQ( 3, tbl.IndexOf( "uel0" ) );
+   REQUIRE_EQ( 2, tbl.GetUserMap( 1 ) );
+   REQUIRE_EQ( 10, tbl.GetMaxUELLength() );
+   tbl.RenameEntry( 1, "i1" );
+   REQUIRE_EQ( 7, tbl.GetMaxUELLength() );
+
+   tbl.Clear();
+   REQUIRE( tbl.empty() );
+   REQUIRE_EQ( 0, tbl.GetMaxUELLength() );
+   REQUIRE( tbl.UsrUel2Ent->empty() );
+   REQUIRE_EQ( -1, tbl.IndexOf( "i1" ) );
+   REQUIRE_EQ( 1, tbl.AddUsrNew( "abc", 3 ) );
+   REQUIRE_EQ( 3, tbl.GetMaxUELLength() );
+}
+
+TEST_CASE( "Test symbol arena" )
+{
+   TSymbolArena arena;
+   arena.SetCapacity( 2 );
+   REQUIRE_EQ( 0, arena.AddString( "", 0 ) );
+   REQUIRE_EQ( ""s, arena.GetString( 0 ) );
+   TgdxSymbRecord *sym = arena.NewSymbol();
+   REQUIRE_FALSE( sym->SDomSymbols );
+   REQUIRE( sym->SComments.empty() );
+   sym->SExplTxt = arena.AddString( "some text", 9 );
+   sym->SDomSymbols = arena.NewIntArray( 3 );
+   REQUIRE_EQ( 0, sym->SDomSymbols[2] );
+   arena.AddComment( *sym, "first", 5 );
+   arena.AddComment( *sym, "second", 6 );
+   REQUIRE_EQ( 2, sym->SComments.size() );
+   REQUIRE_EQ( "some text"s, arena.GetString( sym->SExplTxt ) );
+   REQUIRE_EQ( "first"s, arena.GetComment( *sym, 1 ) );
+   REQUIRE_EQ( "second"s, arena.GetComment( *sym, 2 ) );
+   REQUIRE_FALSE( arena.GetComment( *sym, 3 ) );
+   REQUIRE_FALSE( arena.GetComment( *sym, 0 ) );
+   // appending and looking up comment lines does not walk the earlier ones
+   for( int i { 3 }; i <= 1000; i++ )
+   {
+      const auto line { "line "s + std::to_string( i ) };
+      arena.AddComment( *sym, line.c_str(), line.length() );
+   }
+   REQUIRE_EQ( 1000, sym->SComments.size() );
+   REQUIRE_EQ( "second"s, arena.GetComment( *sym, 2 ) );
+   REQUIRE_EQ( "line 500"s, arena.GetComment( *sym, 500 ) );
+   REQUIRE_EQ( "line 1000"s, arena.GetComment( *sym, 1000 ) );
+   REQUIRE_GT( arena.MemoryUsed(), 0 );
+   TSymbolArena::FreeSymbol( sym );
+   arena.Clear();
+   REQUIRE_EQ( ""s, arena.GetString( 0 ) );
+}
+
+TEST_CASE( "Test acronym list lookup" )
+{
+   for( const bool batch: { false, true } )
+   {
+      TAcronymList acros { batch };
+      REQUIRE_EQ( -1, acros.FindEntry( 1 ) );
+      REQUIRE_EQ( -1, acros.FindName( "acr1" ) );
+      for( int i {}; i < 500; i++ )
+         REQUIRE_EQ( i, acros.AddEntry( ( "acr"s + std::to_string( i ) ).c_str(), "", 1000 + i ) );
+      for( int i {}; i < 500; i++ )
+      {
+         REQUIRE_EQ( i, acros.FindEntry( 1000 + i ) );
+         REQUIRE_EQ( i, acros.FindName( ( "ACR"s + std::to_string( i ) ).c_str() ) );
+      }
+      REQUIRE_EQ( -1, acros.FindEntry( 999 ) );
+      REQUIRE_EQ( -1, acros.FindName( "acr500" ) );
+      // placeholders have no name and are only found by their map number
+      acros.CheckEntry( 7 );
+      acros.CheckEntry( 7 );
+      REQUIRE_EQ( 501, acros.size() );
+      REQUIRE_EQ( 500, acros.FindEntry( 7 ) );
+      REQUIRE_EQ( 500, acros.FindName( "" ) );
+      acros.SetNameAndText( 500, "seven", "text" );
+      REQUIRE_EQ( 500, acros.FindName( "Seven" ) );
+      REQUIRE_EQ( -1, acros.FindName( "" ) );
+      acros.SetNameAndText( 0, "zero", "" );
+      REQUIRE_EQ( -1, acros.FindName( "acr0" ) );
+      REQUIRE_EQ( 0, acros.FindName( "ZERO" ) );
+      // first entry wins for duplicate map numbers
+      REQUIRE_EQ( 501, acros.AddEntry( "dup", "", 1001 ) );
+      REQUIRE_EQ( 1, acros.FindEntry( 1001 ) );
+      REQUIRE_EQ( 501, acros.FindName( "dup" ) );
+   }
+}
+
+TEST_CASE( "Test reusing batch allocator memory" )
+{
+   gdlib::batchalloc::BatchAllocator<1024, 8> alloc;
+   std::vector<uint8_t *> first;
+   for( int i {}; i < 100; i++ )
+      first.push_back( alloc.GetBytes( 100 ) );
+   const size_t cap { alloc.capacity() };
+   REQUIRE_GE( cap, 100 * 104 );
+   alloc.reset();
+   REQUIRE_EQ( cap, alloc.capacity() );
+   // same requests are served from the kept batches
+   for( int i {}; i < 100; i++ )
+      REQUIRE_EQ( first[i], alloc.GetBytes( 100 ) );
+   REQUIRE_EQ( cap, alloc.capacity() );
+   alloc.reset( 2048 );
+   REQUIRE_EQ( 2048, alloc.capacity() );
+   alloc.clear();
+   REQUIRE_EQ( 0, alloc.capacity() );
+
+   LinkedDataType sl { 3, 2 * sizeof( double ) };
+   const std::array<int, 3> keys { 3, 2, 1 };
+   const std::array<double, 2> vals { 1.0, 2.0 };
+   for( int i {}; i < 1000; i++ )
+      sl.AddItem( keys.data(), vals.data() );
+   sl.Reset( 1, sizeof( double ) );
+   REQUIRE_EQ( 0, sl.Count() );
+   sl.AddItem( keys.data(), vals.data() );
+   std::array<int, 1> keyOut {};
+   std::array<double, 1> valOut {};
+   auto it { sl.StartRead() };
+   REQUIRE( it );
+   sl.GetNextRecord( &*it, keyOut.data(), valOut.data() );
+   REQUIRE_EQ( 3, keyOut.front() );
+   REQUIRE_EQ( 1.0, valOut.front() );
+}
+
 TEST_SUITE_END();
 
 }// namespace gdx::tests::gxfiletests
\ No newline at end of file
@@ -23,16 +23,20 @@
  * SOFTWARE.
  */
 
+#include <algorithm>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
+#include <condition_variable>
 #include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
 #include "gdlib/gmsobj.hpp"
 #include "gdlib/strhash.hpp"
@@ -54,11 +58,16 @@ namespace gdxdiff {
 using tvarvaltype = std::uint8_t;
 
 library::ShortString DiffTmpName;
-gdxHandle_t PGX1, PGX2, PGXDIF;
+// Each thread compares through its own pair of input handles
+thread_local gdxHandle_t PGX1, PGX2;
+gdxHandle_t PGXDIF;
 bool diffUELsRegistered;
 // TODO: Use the correct type instead of nullptr type?
 std::unique_ptr<gdlib::strhash::TXStrHashList<std::nullptr_t>> UELTable;
-int staticUELNum;
+int staticUELNum, NrThreads;
+// UEL numbers of the extra index positions written to the diff file
+int UELIns1, UELIns2, UELDif1, UELDif2;
+std::array<int, GMS_VAL_MAX> UELFields;
 double EpsAbsolute, EpsRelative;
 std::map<library::ShortString, StatusCode> StatusTable;
 std::unique_ptr<library::cmdpar::CmdParams> CmdParams;
@@ -69,6 +78,7 @@ bool DiffOnly, CompSetText, matrixFile, ignoreOrder;
 std::unique_ptr<gdlib::gmsobj::TXStrings> IDsOnly;
 std::unique_ptr<gdlib::gmsobj::TXStrings> SkipIDs;
 bool ShowDefRec, CompDomains;
+bool SameUELs, SameSetTexts, SameAcronyms;
 
 std::string ValAsString(const gdxHandle_t &PGX, const double V) {
   constexpr int WIDTH{14};
@@ -152,6 +162,97 @@ void OpenGDX(const std::string &fn, gdxHandle_t &PGX) {
   CheckGDXError(PGX);
 }
 
+bool UELTablesEqual() {
+  int NrElem1, NrElem2, HighV;
+  gdxUMUelInfo(PGX1, &NrElem1, &HighV);
+  gdxUMUelInfo(PGX2, &NrElem2, &HighV);
+  if (NrElem1 != NrElem2) {
+    return false;
+  }
+  library::ShortString UEL1, UEL2;
+  for (int N{1}; N <= NrElem1; N++) {
+    int NN;
+    gdxUMUelGet(PGX1, N, UEL1.data(), &NN);
+    gdxUMUelGet(PGX2, N, UEL2.data(), &NN);
+    if (std::strcmp(UEL1.data(), UEL2.data()) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool SetTextsEqual() {
+  library::ShortString S1, S2;
+  for (int N{1};; N++) {
+    int Node;
+    const bool Has1{gdxGetElemText(PGX1, N, S1.data(), &Node) != 0},
+        Has2{gdxGetElemText(PGX2, N, S2.data(), &Node) != 0};
+    if (Has1 != Has2 || std::strcmp(S1.data(), S2.data()) != 0) {
+      return false;
+    }
+    if (!Has1) {
+      return true;
+    }
+  }
+}
+
+bool AcronymsEqual() {
+  const int NrAcr{gdxAcronymCount(PGX1)};
+  if (NrAcr != gdxAcronymCount(PGX2)) {
+    return false;
+  }
+  library::ShortString Name1, Name2, Text;
+  for (int N{1}; N <= NrAcr; N++) {
+    int Indx1, Indx2;
+    gdxAcronymGetInfo(PGX1, N, Name1.data(), Text.data(), &Indx1);
+    gdxAcronymGetInfo(PGX2, N, Name2.data(), Text.data(), &Indx2);
+    if (Indx1 != Indx2 || std::strcmp(Name1.data(), Name2.data()) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool SameDataBytes(const int Sy1, const int Sy2) {
+  constexpr int ChunkSize{1 << 16};
+  std::vector<char> Chunk1(ChunkSize), Chunk2(ChunkSize);
+  for (int64_t Offset{};;) {
+    const int N1{gdxSymbolDataBytes(PGX1, Sy1, Offset, ChunkSize, Chunk1.data())},
+        N2{gdxSymbolDataBytes(PGX2, Sy2, Offset, ChunkSize, Chunk2.data())};
+    if (N1 < 0 || N1 != N2 || std::memcmp(Chunk1.data(), Chunk2.data(), N1) != 0) {
+      return false;
+    }
+    if (N1 < ChunkSize) {
+      return true;
+    }
+    Offset += N1;
+  }
+}
+
+bool SameSymbolData(const int Sy1, const int Sy2, const gdxSyType ST) {
+  if (!SameAcronyms) {
+    return false;
+  }
+
+  // Different fingerprints always mean different records
+  library::ShortString S1, S2;
+  const bool HaveFingerprints{gdxSymbolFingerprint(PGX1, Sy1, S1.data()) != 0 &&
+                              gdxSymbolFingerprint(PGX2, Sy2, S2.data()) != 0};
+  if (HaveFingerprints && std::strcmp(S1.data(), S2.data()) != 0) {
+    return false;
+  }
+
+  // The stored bytes refer to UEL and text numbers; when they mean the same in both
+  // files, comparing the bytes is exact and stops at the first difference
+  if (SameUELs && (ST != dt_set || SameSetTexts)) {
+    return SameDataBytes(Sy1, Sy2);
+  }
+
+  // Otherwise rely on the fingerprints, which only depend on the UEL strings;
+  // as 64 bit hashes they can collide, although that is very unlikely
+  return HaveFingerprints;
+}
+
 void RegisterDiffUELs() {
   if (diffUELsRegistered) {
     return;
@@ -170,7 +271,98 @@ void RegisterDiffUELs() {
   diffUELsRegistered = true;
 }
 
-void CompareSy(const int Sy1, const int Sy2) {
+void TSymbolDiff::WriteStart() const {
+  gdxDataWriteStrStart(PGXDIF, ID.data(), ExplTxt.data(), Dim, Typ, UserInfo);
+}
+
+void TSymbolDiff::WriteRecord(const int *RecKeys, const double *RecVals, const char *Text) const {
+  gdxStrIndex_t StrKeys{};
+  gdxStrIndexPtrs_t StrKeysPtrs;
+  GDXSTRINDEXPTRS_INIT(StrKeys, StrKeysPtrs);
+
+  gdxValues_t WriteVals;
+  std::copy(RecVals, RecVals + GMS_VAL_MAX, WriteVals);
+  for (int D{}; D < Dim; D++) {
+    // TODO: Improve this check (especially the else case)
+    if (RecKeys[D] < UELTable->Count()) {
+      std::strcpy(StrKeysPtrs[D], UELTable->GetString(RecKeys[D]));
+    } else {
+      std::snprintf(StrKeysPtrs[D], GMS_SSSIZE, "L__%d", RecKeys[D]);
+    }
+  }
+  if (Text) {
+    int iNode;
+    gdxAddSetText(PGXDIF, Text, &iNode);
+    WriteVals[GMS_VAL_LEVEL] = iNode;
+  }
+  gdxDataWriteStr(PGXDIF, const_cast<const char **>(StrKeysPtrs), WriteVals);
+}
+
+void TSymbolDiff::RegisterUELs() {
+  if (Buffered) {
+    NeedUELs = true;
+  } else {
+    RegisterDiffUELs();
+  }
+}
+
+void TSymbolDiff::Start(const std::string &AExplTxt, const int ADim, const int ATyp, const int AUserInfo) {
+  RegisterUELs();
+  ExplTxt = AExplTxt;
+  Dim = ADim;
+  Typ = ATyp;
+  UserInfo = AUserInfo;
+  Started = true;
+  if (!Buffered) {
+    WriteStart();
+  }
+}
+
+void TSymbolDiff::Write(const int *RecKeys, const double *RecVals, const char *Text) {
+  if (!Buffered) {
+    WriteRecord(RecKeys, RecVals, Text);
+    return;
+  }
+  Keys.insert(Keys.end(), RecKeys, RecKeys + Dim);
+  Vals.insert(Vals.end(), RecVals, RecVals + GMS_VAL_MAX);
+  if (Text) {
+    TextNrs.push_back(static_cast<int>(Texts.size()));
+    Texts.emplace_back(Text);
+  } else {
+    TextNrs.push_back(-1);
+  }
+}
+
+void TSymbolDiff::Done() {
+  if (!Buffered) {
+    CheckGDXError(PGXDIF);
+    gdxDataWriteDone(PGXDIF);
+    CheckGDXError(PGXDIF);
+  }
+}
+
+void TSymbolDiff::Finish() {
+  std::cout << Report.str();
+  if (Buffered) {
+    if (NeedUELs) {
+      RegisterDiffUELs();
+    }
+    if (Started) {
+      WriteStart();
+      for (std::size_t R{}; R < TextNrs.size(); R++) {
+        WriteRecord(&Keys[R * Dim], &Vals[R * GMS_VAL_MAX], TextNrs[R] < 0 ? nullptr : Texts[TextNrs[R]].data());
+      }
+      Buffered = false;
+      Done();
+    }
+  }
+  if (Status != StatusCode::sc_same &&
+      Status != StatusCode::sc_dim10) {
+    StatusTable.insert({ID, Status});
+  }
+}
+
+void CompareSy(const int Sy1, const int Sy2, TSymbolDiff &Diff) {
   int Dim, VarEquType;
   gdxSyType ST;
   library::ShortString ID;
@@ -179,18 +371,17 @@ void CompareSy(const int Sy1, const int Sy2) {
   gdxValues_t DefValues{};
 
   auto CheckSymbOpen = [&]() -> bool {
-    RegisterDiffUELs();
+    Diff.RegisterUELs();
     if (Status == StatusCode::sc_dim10) {
       Status = StatusCode::sc_dim10_diff;
     }
     if (!SymbOpen && Status != StatusCode::sc_dim10_diff) {
       if (fldOnly == FldOnly::fld_yes && (ST == dt_var || ST == dt_equ)) {
-        library::ShortString ExplTxt{"Differences Field = " + GamsFieldNames[fldOnlyFld]};
-        gdxDataWriteStrStart(PGXDIF, ID.data(), ExplTxt.data(), Dim + 1, static_cast<int>(dt_par), 0);
+        Diff.Start("Differences Field = " + GamsFieldNames[fldOnlyFld], Dim + 1, static_cast<int>(dt_par), 0);
       } else if (DiffOnly && (ST == dt_var || ST == dt_equ)) {
-        gdxDataWriteStrStart(PGXDIF, ID.data(), "Differences Only", Dim + 2, static_cast<int>(dt_par), 0);
+        Diff.Start("Differences Only", Dim + 2, static_cast<int>(dt_par), 0);
       } else {
-        gdxDataWriteStrStart(PGXDIF, ID.data(), "Differences", Dim + 1, static_cast<int>(ST), VarEquType);
+        Diff.Start("Differences", Dim + 1, static_cast<int>(ST), VarEquType);
       }
       SymbOpen = true;
     }
@@ -200,69 +391,33 @@ void CompareSy(const int Sy1, const int Sy2) {
   auto SymbClose = [&]() -> void {
     if (SymbOpen) {
       SymbOpen = false;
-      CheckGDXError(PGXDIF);
-      gdxDataWriteDone(PGXDIF);
-      CheckGDXError(PGXDIF);
+      Diff.Done();
     }
   };
 
-  auto WriteDiff = [&](const std::string &Act, const std::string &FldName, const gdxUelIndex_t &Keys, const gdxValues_t &Vals) -> void {
-    gdxStrIndex_t StrKeys{};
-    gdxStrIndexPtrs_t StrKeysPtrs;
-    GDXSTRINDEXPTRS_INIT(StrKeys, StrKeysPtrs);
-
-    gdxValues_t Vals2{};
-
-    RegisterDiffUELs();
-    for (int D{}; D < Dim; D++) {
-      // TODO: Improve this check (especially the else case)
-      if (Keys[D] < UELTable->Count()) {
-        std::strcpy(StrKeysPtrs[D], UELTable->GetString(Keys[D]));
-      } else {
-        std::snprintf(StrKeysPtrs[D], GMS_SSSIZE, "L__%d", Keys[D]);
-      }
-    }
+  // Keys of the diff record are UEL numbers, extended by the field and the action
+  auto WriteDiff = [&](const int Act, const int FldName, const gdxUelIndex_t &Keys, const gdxValues_t &Vals, const char *Text = nullptr) -> void {
+    gdxUelIndex_t DiffKeys;
+    std::copy(Keys, Keys + Dim, DiffKeys);
     if (!DiffOnly || (ST != dt_var && ST != dt_equ)) {
-      std::strcpy(StrKeysPtrs[Dim], Act.data());
+      DiffKeys[Dim] = Act;
     } else {
-      std::strcpy(StrKeysPtrs[Dim], FldName.data());
-      std::strcpy(StrKeysPtrs[Dim + 1], Act.data());
-    }
-
-#if VERBOSE >= 3
-    for (int D{}; D < Dim + 1; D++) {
-      std::cout << StrKeys[D];
-      if (D < Dim + 1) {
-        std::cout << ", ";
-      }
+      DiffKeys[Dim] = FldName;
+      DiffKeys[Dim + 1] = Act;
     }
-    std::cout << '\n';
-#endif
 
     if (fldOnly == FldOnly::fld_yes && (ST == dt_var || ST == dt_equ)) {
+      gdxValues_t Vals2{};
       Vals2[GMS_VAL_LEVEL] = Vals[fldOnlyFld];
-      gdxDataWriteStr(PGXDIF, const_cast<const char **>(StrKeysPtrs), Vals2);
+      Diff.Write(DiffKeys, Vals2, Text);
     } else {
-      gdxDataWriteStr(PGXDIF, const_cast<const char **>(StrKeysPtrs), Vals);
+      Diff.Write(DiffKeys, Vals, Text);
     }
   };
 
-  auto WriteSetDiff = [&](const std::string &Act, const gdxUelIndex_t &Keys, const library::ShortString &S) -> void {
-    gdxStrIndex_t StrKeys{};
-    gdxStrIndexPtrs_t StrKeysPtrs;
-    GDXSTRINDEXPTRS_INIT(StrKeys, StrKeysPtrs);
-
+  auto WriteSetDiff = [&](const int Act, const gdxUelIndex_t &Keys, const library::ShortString &S) -> void {
     gdxValues_t Vals{};
-    int iNode;
-
-    RegisterDiffUELs();
-    for (int D{}; D < Dim; D++) {
-      std::strcpy(StrKeysPtrs[D], UELTable->GetString(Keys[D]));
-    }
-    std::strcpy(StrKeysPtrs[Dim], Act.data());
-    gdxAddSetText(PGXDIF, S.data(), &iNode);
-    Vals[GMS_VAL_LEVEL] = iNode;
-    gdxDataWriteStr(PGXDIF, const_cast<const char **>(StrKeysPtrs), Vals);
+    WriteDiff(Act, {}, Keys, Vals, S.data());
   };
 
 #if VERBOSE >= 2
@@ -273,23 +428,23 @@ void CompareSy(const int Sy1, const int Sy2) {
       break;
 
     case dt_par:
-      std::cout << ValAsString(PGX, Vals[GMS_VAL_LEVEL]) << '\n';
+      Diff.Report << ValAsString(PGX, Vals[GMS_VAL_LEVEL]) << '\n';
       break;
 
     default:
       for (int T{}; T < GMS_VAL_MAX; T++) {
-        std::cout << ValAsString(PGX, Vals[T]) << ' ';
+        Diff.Report << ValAsString(PGX, Vals[T]) << ' ';
       }
-      std::cout << '\n';
+      Diff.Report << '\n';
     }
   };
 
   auto WriteKeys = [&](const gdxUelIndex_t &Keys) -> void {
-    RegisterDiffUELs();
+    Diff.RegisterUELs();
     for (int D{}; D < Dim; D++) {
-      std::cout << ' ' << UELTable->GetString(Keys[D]);
+      Diff.Report << ' ' << UELTable->GetString(Keys[D]);
       if (D < Dim) {
-        std::cout << " .";
+        Diff.Report << " .";
       }
     }
   };
@@ -354,9 +509,9 @@ void CompareSy(const int Sy1, const int Sy2) {
     }
     if (!result) {
 #if VERBOSE >= 2
-      std::cout << "Different ";
+      Diff.Report << "Different ";
       WriteKeys(Keys);
-      std::cout << '\n';
+      Diff.Report << '\n';
       WriteValues(PGX1, V1);
       WriteValues(PGX2, V2);
 #endif
@@ -366,8 +521,8 @@ void CompareSy(const int Sy1, const int Sy2) {
       }
 
       if (!DiffOnly || (ST != dt_var && ST != dt_equ)) {
-        WriteDiff(c_dif1, {}, Keys, V1);
-        WriteDiff(c_dif2, {}, Keys, V2);
+        WriteDiff(UELDif1, {}, Keys, V1);
+        WriteDiff(UELDif2, {}, Keys, V2);
       } else {
         for (int T{}; T < GMS_VAL_MAX; T++) {
           if (!ActiveFields.contains(static_cast<tvarvaltype>(T)) ||
@@ -377,9 +532,9 @@ void CompareSy(const int Sy1, const int Sy2) {
 
           gdxValues_t Vals{};
           Vals[GMS_VAL_LEVEL] = V1[T];
-          WriteDiff(c_dif1, GamsFieldNames[T], Keys, Vals);
+          WriteDiff(UELDif1, UELFields[T], Keys, Vals);
           Vals[GMS_VAL_LEVEL] = V2[T];
-          WriteDiff(c_dif2, GamsFieldNames[T], Keys, Vals);
+          WriteDiff(UELDif2, UELFields[T], Keys, Vals);
         }
       }
     }
@@ -403,9 +558,9 @@ void CompareSy(const int Sy1, const int Sy2) {
     bool result{S1 == S2};
     if (!result) {
 #if VERBOSE >= 2
-      std::cout << "Associated text is different ";
+      Diff.Report << "Associated text is different ";
       WriteKeys(Keys);
-      std::cout << '\n'
+      Diff.Report << '\n'
                 << S1 << '\n'
                 << S2 << '\n';
 #endif
@@ -414,13 +569,13 @@ void CompareSy(const int Sy1, const int Sy2) {
         return {};
       }
 
-      WriteSetDiff(c_dif1, Keys, S1);
-      WriteSetDiff(c_dif2, Keys, S2);
+      WriteSetDiff(UELDif1, Keys, S1);
+      WriteSetDiff(UELDif2, Keys, S2);
     }
     return result;
   };
 
-  auto ShowInsert = [&](const std::string &Act, const gdxUelIndex_t &Keys, gdxValues_t &Vals) -> void {
+  auto ShowInsert = [&](const int Act, const gdxUelIndex_t &Keys, gdxValues_t &Vals) -> void {
     // We check if this insert has values we want to ignore
     bool Eq{};
 
@@ -461,20 +616,17 @@ void CompareSy(const int Sy1, const int Sy2) {
     }
 
 #if VERBOSE >= 2
-    std::cout << "Insert: " << Act << ' ';
+    Diff.Report << "Insert: " << UELTable->GetString(Act) << ' ';
 #endif
 
     if (ST == dt_set && Vals[GMS_VAL_LEVEL] != 0) {
       library::ShortString stxt;
       int N;
       gdxGetElemText(
-          Act == c_ins1 ? PGX1 : PGX2,
+          Act == UELIns1 ? PGX1 : PGX2,
           utils::round<int>(Vals[GMS_VAL_LEVEL]), stxt.data(), &N);
-      gdxAddSetText(PGXDIF, stxt.data(), &N);
-      Vals[GMS_VAL_LEVEL] = N;
-    }
-
-    if (!DiffOnly || (ST != dt_var && ST != dt_equ)) {
+      WriteDiff(Act, {}, Keys, Vals, stxt.data());
+    } else if (!DiffOnly || (ST != dt_var && ST != dt_equ)) {
       WriteDiff(Act, {}, Keys, Vals);
     } else {
       gdxValues_t Vals2{};
@@ -484,7 +636,7 @@ void CompareSy(const int Sy1, const int Sy2) {
         }
 
         Vals2[GMS_VAL_LEVEL] = Vals[T];
-        WriteDiff(Act, GamsFieldNames[T], Keys, Vals2);
+        WriteDiff(Act, UELFields[T], Keys, Vals2);
       }
     }
   };
@@ -519,15 +671,16 @@ void CompareSy(const int Sy1, const int Sy2) {
     ST2 = dt_set;
   }
   Status = StatusCode::sc_same;
+  Diff.ID = ID;
 
   if (Dim != Dim2 || ST != ST2) {
-    std::cout << "*** symbol = " << ID << " cannot be compared\n";
+    Diff.Report << "*** symbol = " << ID << " cannot be compared\n";
     if (ST != ST2) {
-      std::cout << "Typ1 = " << library::gdxDataTypStrL(ST) << ", Typ2 = " << library::gdxDataTypStrL(ST2) << '\n';
+      Diff.Report << "Typ1 = " << library::gdxDataTypStrL(ST) << ", Typ2 = " << library::gdxDataTypStrL(ST2) << '\n';
       Status = StatusCode::sc_typ;
     }
     if (Dim != Dim2) {
-      std::cout << "Dim1 = " << Dim << ", Dim2 = " << Dim2 << '\n';
+      Diff.Report << "Dim1 = " << Dim << ", Dim2 = " << Dim2 << '\n';
       if (Status == StatusCode::sc_same) {
         Status = StatusCode::sc_dim;
       }
@@ -550,16 +703,16 @@ void CompareSy(const int Sy1, const int Sy2) {
       Status = StatusCode::sc_domain;
 
 #if VERBOSE >= 1
-      std::cout << "Domain differences for symbol = " << ID << '\n';
+      Diff.Report << "Domain differences for symbol = " << ID << '\n';
       for (int D{}; D < Dim; D++) {
         if (gdlib::strutilx::StrUEqual(DomSy1[D], DomSy2[D])) {
           continue;
         }
 
-        std::cout << gdlib::strutilx::PadRight(std::to_string(D), 2)
+        Diff.Report << gdlib::strutilx::PadRight(std::to_string(D), 2)
                   << ' ' << DomSy1[D] << ' ' << DomSy2[D] << '\n';
       }
-      std::cout << '\n';
+      Diff.Report << '\n';
 #endif
 
       goto label999;
@@ -567,7 +720,7 @@ void CompareSy(const int Sy1, const int Sy2) {
   }
 
 #if VERBOSE >= 1
-  std::cout << library::gdxDataTypStrL(ST) << ' ' << ID << '\n';
+  Diff.Report << library::gdxDataTypStrL(ST) << ' ' << ID << '\n';
 #endif
 
   // Create default record for this type
@@ -583,6 +736,11 @@ void CompareSy(const int Sy1, const int Sy2) {
     Status = StatusCode::sc_dim10;
   }
 
+  // Symbols with identical records cannot show any differences
+  if (SameSymbolData(Sy1, Sy2, ST)) {
+    goto label999;
+  }
+
   if (matrixFile) {
     Flg1 = gdxDataReadRawStart(PGX1, Sy1, &R1Last) != 0;
     if (Flg1) {
@@ -643,14 +801,14 @@ void CompareSy(const int Sy1, const int Sy2) {
     }
     // Change in status happens inside ShowInsert
     else if (C < 0) {
-      ShowInsert(c_ins1, Keys1, Vals1);
+      ShowInsert(UELIns1, Keys1, Vals1);
       if (matrixFile) {
         Flg1 = gdxDataReadRaw(PGX1, Keys1, Vals1, &AFDim) != 0;
       } else {
         Flg1 = gdxDataReadMap(PGX1, 0, Keys1, Vals1, &AFDim) != 0;
       }
     } else {
-      ShowInsert(c_ins2, Keys2, Vals2);
+      ShowInsert(UELIns2, Keys2, Vals2);
       if (matrixFile) {
         Flg2 = gdxDataReadRaw(PGX2, Keys2, Vals2, &AFDim) != 0;
       } else {
@@ -660,7 +818,7 @@ void CompareSy(const int Sy1, const int Sy2) {
   }
 
   while (Flg1) {
-    ShowInsert(c_ins1, Keys1, Vals1);
+    ShowInsert(UELIns1, Keys1, Vals1);
     if (matrixFile) {
       Flg1 = gdxDataReadRaw(PGX1, Keys1, Vals1, &AFDim) != 0;
     } else {
@@ -669,7 +827,7 @@ void CompareSy(const int Sy1, const int Sy2) {
   }
 
   while (Flg2) {
-    ShowInsert(c_ins2, Keys2, Vals2);
+    ShowInsert(UELIns2, Keys2, Vals2);
     if (matrixFile) {
       Flg2 = gdxDataReadRaw(PGX2, Keys2, Vals2, &AFDim) != 0;
     } else {
@@ -677,12 +835,81 @@ void CompareSy(const int Sy1, const int Sy2) {
     }
   }
 
+  // gdxSymbolDataBytes refuses to work while a read is in progress, so never leave one open
+  gdxDataReadDone(PGX1);
+  gdxDataReadDone(PGX2);
   SymbClose();
 
 label999:
-  if (Status != StatusCode::sc_same &&
-      Status != StatusCode::sc_dim10) {
-    StatusTable.insert({ID, Status});
+  Diff.Status = Status;
+}
+
+void CompareSymbolsParallel(const std::string &InFile1, const std::string &InFile2, const std::vector<std::pair<int, int>> &Pairs) {
+  const int NrWorkers{std::min(NrThreads, static_cast<int>(Pairs.size()))};
+
+  // Every worker reads through its own pair of handles; the UEL table already
+  // knows all elements, so the maps registered here match those of PGX1 and PGX2
+  std::vector<gdxHandle_t> Handles1(NrWorkers), Handles2(NrWorkers);
+  for (int W{}; W < NrWorkers; W++) {
+    OpenGDX(InFile1, Handles1[W]);
+    OpenGDX(InFile2, Handles2[W]);
+  }
+
+  // Workers may run at most Window symbols ahead of the one written next
+  const std::size_t Window{2 * static_cast<std::size_t>(NrWorkers)};
+  std::vector<std::unique_ptr<TSymbolDiff>> Results(Pairs.size());
+  std::size_t NextPair{}, NextFinish{};
+  std::mutex Mutex;
+  std::condition_variable Changed;
+
+  std::vector<std::thread> Workers;
+  Workers.reserve(NrWorkers);
+  for (int W{}; W < NrWorkers; W++) {
+    Workers.emplace_back([&, W]() {
+      PGX1 = Handles1[W];
+      PGX2 = Handles2[W];
+      while (true) {
+        std::size_t P;
+        {
+          std::unique_lock<std::mutex> Lock{Mutex};
+          Changed.wait(Lock, [&]() { return NextPair >= Pairs.size() || NextPair < NextFinish + Window; });
+          if (NextPair >= Pairs.size()) {
+            break;
+          }
+          P = NextPair++;
+        }
+        auto Diff{std::make_unique<TSymbolDiff>(true)};
+        CompareSy(Pairs[P].first, Pairs[P].second, *Diff);
+        {
+          std::lock_guard<std::mutex> Lock{Mutex};
+          Results[P] = std::move(Diff);
+        }
+        Changed.notify_all();
+      }
+    });
+  }
+
+  // Write the differences in symbol order, as a serial run does
+  for (std::size_t P{}; P < Pairs.size(); P++) {
+    std::unique_ptr<TSymbolDiff> Diff;
+    {
+      std::unique_lock<std::mutex> Lock{Mutex};
+      Changed.wait(Lock, [&]() { return Results[P] != nullptr; });
+      Diff = std::move(Results[P]);
+      NextFinish = P + 1;
+    }
+    Changed.notify_all();
+    Diff->Finish();
+  }
+
+  for (auto &Worker : Workers) {
+    Worker.join();
+  }
+  for (int W{}; W < NrWorkers; W++) {
+    gdxClose(Handles1[W]);
+    gdxFree(&Handles1[W]);
+    gdxClose(Handles2[W]);
+    gdxFree(&Handles2[W]);
   }
 }
 
@@ -715,6 +942,7 @@ void Usage(const library::AuditLine &auditLine) {
          "      SetDesc = Y|N       compare explanatory texts for set elements, activated by default (=Y)\n"
          "      ID      = one or more identifiers; only ids listed will be compared\n"
          "      SkipID  = one or more identifiers; ids listed will be skipped\n"
+         "      Threads = N         number of symbols compared in parallel; 0 uses all cores (default 1)\n"
          "   The .gdx file extension is the default\n";
 }
 
@@ -762,6 +990,7 @@ int main(const int argc, const char *argv[]) {
   CmdParams->AddParam(static_cast<int>(KP::kp_ide), "IDE");
   CmdParams->AddParam(static_cast<int>(KP::kp_id), "ID");
   CmdParams->AddParam(static_cast<int>(KP::kp_skip_id), "SkipID");
+  CmdParams->AddParam(static_cast<int>(KP::kp_threads), "Threads");
 
   CmdParams->AddKeyWord(static_cast<int>(KP::kp_fldonly), "FldOnly");
   CmdParams->AddKeyWord(static_cast<int>(KP::kp_diffonly), "DiffOnly");
@@ -910,6 +1139,16 @@ int main(const int argc, const char *argv[]) {
     }
   }
 
+  NrThreads = 1;
+  if (CmdParams->HasParam(static_cast<int>(KP::kp_threads), S)) {
+    if (!gdlib::strutilx::StrAsIntEx(S.data(), NrThreads) || NrThreads < 0) {
+      std::cout << "Bad value for Threads = " << S << '\n';
+      ErrorCode = 4;
+    } else if (NrThreads == 0) {
+      NrThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+  }
+
   ShowDefRec = CmdParams->HasKey(static_cast<int>(KP::kp_showdef));
   CompDomains = CmdParams->HasKey(static_cast<int>(KP::kp_cmpdomain));
 
@@ -1019,14 +1258,14 @@ int main(const int argc, const char *argv[]) {
   // UELTable->OneBased = true;
   gdxStoreDomainSetsSet(PGXDIF, 0);
 
-  UELTable->Add(c_ins1.data(), c_ins1.length());
-  UELTable->Add(c_ins2.data(), c_ins2.length());
-  UELTable->Add(c_dif1.data(), c_dif1.length());
-  UELTable->Add(c_dif2.data(), c_dif2.length());
+  UELIns1 = UELTable->Add(c_ins1.data(), c_ins1.length());
+  UELIns2 = UELTable->Add(c_ins2.data(), c_ins2.length());
+  UELDif1 = UELTable->Add(c_dif1.data(), c_dif1.length());
+  UELDif2 = UELTable->Add(c_dif2.data(), c_dif2.length());
 
   if (DiffOnly) {
     for (int T{}; T < GMS_VAL_MAX; T++) {
-      UELTable->Add(GamsFieldNames[T].data(), GamsFieldNames[T].length());
+      UELFields[T] = UELTable->Add(GamsFieldNames[T].data(), GamsFieldNames[T].length());
     }
   }
 
@@ -1036,6 +1275,10 @@ int main(const int argc, const char *argv[]) {
   OpenGDX(InFile1, PGX1);
   OpenGDX(InFile2, PGX2);
 
+  SameUELs = UELTablesEqual();
+  SameSetTexts = SetTextsEqual();
+  SameAcronyms = AcronymsEqual();
+
   {
     int N{1};
     while (gdxSymbolInfo(PGX1, N, ID.data(), &Dim, &iST) != 0) {
@@ -1047,12 +1290,25 @@ int main(const int argc, const char *argv[]) {
     }
   }
 
-  for (const auto &pair : IDTable) {
-    int NN;
-    if (gdxFindSymbol(PGX2, pair.first.data(), &NN) != 0) {
-      CompareSy(pair.second, NN);
+  {
+    std::vector<std::pair<int, int>> Pairs;
+    for (const auto &pair : IDTable) {
+      int NN;
+      if (gdxFindSymbol(PGX2, pair.first.data(), &NN) != 0) {
+        Pairs.emplace_back(pair.second, NN);
+      } else {
+        StatusTable.insert({pair.first, StatusCode::sc_notf2});
+      }
+    }
+
+    if (NrThreads > 1 && Pairs.size() > 1) {
+      CompareSymbolsParallel(InFile1, InFile2, Pairs);
     } else {
-      StatusTable.insert({pair.first, StatusCode::sc_notf2});
+      for (const auto &pair : Pairs) {
+        TSymbolDiff Diff{false};
+        CompareSy(pair.first, pair.second, Diff);
+        Diff.Finish();
+      }
     }
   }
 
@@ -2,8 +2,11 @@
 
 #include <array>
 #include <cstdint>
+#include <sstream>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include "library/common.hpp"
 #include "library/short_string.hpp"
@@ -61,7 +64,8 @@ enum class KP : std::uint8_t {
   kp_cmpdomain,
   kp_matrixfile,
   kp_ignoreOrd,
-  kp_skip_id
+  kp_skip_id,
+  kp_threads
 };
 
 constexpr std::array StatusText{
@@ -102,9 +106,48 @@ void CheckGDXError(const gdxHandle_t &PGX);
 
 void OpenGDX(const std::string &fn, gdxHandle_t &PGX);
 
+bool UELTablesEqual();
+
+bool SetTextsEqual();
+
+bool AcronymsEqual();
+
+bool SameDataBytes(int Sy1, int Sy2);
+
+bool SameSymbolData(int Sy1, int Sy2, gdxSyType ST);
+
 void RegisterDiffUELs();
 
-void CompareSy(int Sy1, int Sy2);
+// Differences found for one symbol. A serial comparison passes the records straight on to the diff file;
+// a parallel one keeps them until the main thread writes the symbol in its turn
+class TSymbolDiff {
+  bool Buffered, NeedUELs{}, Started{};
+  std::string ExplTxt;
+  int Dim{}, Typ{}, UserInfo{};
+  std::vector<int> Keys, TextNrs;
+  std::vector<double> Vals;
+  std::vector<std::string> Texts;
+
+  void WriteStart() const;
+  void WriteRecord(const int *RecKeys, const double *RecVals, const char *Text) const;
+
+public:
+  library::ShortString ID;
+  StatusCode Status{StatusCode::sc_same};
+  std::ostringstream Report;
+
+  explicit TSymbolDiff(bool Buffered) : Buffered{Buffered} {}
+
+  void RegisterUELs();
+  void Start(const std::string &AExplTxt, int ADim, int ATyp, int AUserInfo);
+  void Write(const int *RecKeys, const double *RecVals, const char *Text);
+  void Done();
+  void Finish();
+};
+
+void CompareSy(int Sy1, int Sy2, TSymbolDiff &Diff);
+
+void CompareSymbolsParallel(const std::string &InFile1, const std::string &InFile2, const std::vector<std::pair<int, int>> &Pairs);
 
 bool GetAsDouble(const library::ShortString &S, double &V);
 
@@ -24,6 +24,7 @@
  */
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstddef>
 #include <cstring>
 #include <fstream>
@@ -31,9 +32,16 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <sstream>
 #include <string_view>
+#include <thread>
+#include <vector>
+
+#include <zlib.h>
 
 #include "gdlib/dblutil.hpp"
+#include "gdlib/gmsobj.hpp"
 #include "gdlib/strutilx.hpp"
 #include "gdlib/utils.hpp"
 #include "gdxdump.hpp"
@@ -49,16 +57,208 @@ namespace gdxdump {
 
 using namespace std::literals::string_literals;
 
-std::ostream &fo{std::cout};
+// Each thread formats into its own stream and reads through its own GDX handle
+thread_local std::ostream fo{std::cout.rdbuf()};
+thread_local TOutputBuffer *Out;
 std::ofstream OutputFile;
-gdxHandle_t PGX;
+thread_local gdxHandle_t PGX;
+TUELCache UELCache;
+thread_local TValueClassifier ValueClassifier;
 char Delim, DecimalSep;
 bool ShowHdr, ShowData, CDim, FilterDef, bEpsOut, bNaOut, bPinfOut, bMinfOut, bUndfOut, bZeroOut, bHeader, bFullEVRec, bCSVSetText;
 OutFormat outFormat;
 DblFormat dblFormat;
-int LineCount;
+int LineCount, NrThreads;
 std::string EpsOut, NaOut, PinfOut, MinfOut, UndfOut, ZeroOut, Header;
 
+TOutputBuffer::TOutputBuffer(std::streambuf *Dest, const std::size_t Size) : Dest{Dest}, Buffer(Size) {
+  setp(Buffer.data(), Buffer.data() + Buffer.size());
+}
+
+TOutputBuffer::~TOutputBuffer() {
+  FlushBuffer();
+}
+
+bool TOutputBuffer::FlushBuffer() {
+  const std::streamsize n{pptr() - pbase()};
+  if (n > 0 && Dest->sputn(pbase(), n) != n) {
+    return false;
+  }
+  setp(Buffer.data(), Buffer.data() + Buffer.size());
+  return true;
+}
+
+TOutputBuffer::int_type TOutputBuffer::overflow(const int_type c) {
+  if (!FlushBuffer()) {
+    return traits_type::eof();
+  }
+  if (!traits_type::eq_int_type(c, traits_type::eof())) {
+    *pptr() = traits_type::to_char_type(c);
+    pbump(1);
+  }
+  return traits_type::not_eof(c);
+}
+
+std::streamsize TOutputBuffer::xsputn(const char *s, const std::streamsize n) {
+  if (n > epptr() - pptr()) {
+    if (!FlushBuffer()) {
+      return 0;
+    }
+    // Too large to be worth copying
+    if (n >= static_cast<std::streamsize>(Buffer.size())) {
+      return Dest->sputn(s, n);
+    }
+  }
+  std::memcpy(pptr(), s, n);
+  pbump(static_cast<int>(n));
+  return n;
+}
+
+int TOutputBuffer::sync() {
+  return FlushBuffer() && Dest->pubsync() == 0 ? 0 : -1;
+}
+
+TGzipOutput::TGzipOutput(std::streambuf *Dest, const int NrWorkers) : Dest{Dest}, Chunk(ChunkSize), MaxPending{2 * static_cast<std::size_t>(NrWorkers)} {
+  setp(Chunk.data(), Chunk.data() + Chunk.size());
+  Workers.reserve(NrWorkers);
+  for (int N{}; N < NrWorkers; N++) {
+    Workers.emplace_back(&TGzipOutput::Compress, this);
+  }
+}
+
+TGzipOutput::~TGzipOutput() {
+  sync();
+  {
+    std::lock_guard<std::mutex> Lock{Mutex};
+    Stopping = true;
+  }
+  WorkCond.notify_all();
+  for (std::thread &T: Workers) {
+    T.join();
+  }
+}
+
+void TGzipOutput::Compress() {
+  while (true) {
+    std::shared_ptr<TMember> Member;
+    {
+      std::unique_lock<std::mutex> Lock{Mutex};
+      WorkCond.wait(Lock, [&] { return Stopping || !Queue.empty(); });
+      if (Queue.empty()) {
+        return;
+      }
+      Member = Queue.front();
+      Queue.pop_front();
+    }
+    // Window bits above 15 make deflate write the gzip header and trailer
+    std::vector<char> Packed;
+    z_stream zs{};
+    bool Ok{deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) == Z_OK};
+    if (Ok) {
+      Packed.resize(deflateBound(&zs, static_cast<uLong>(Member->Data.size())));
+      zs.next_in = reinterpret_cast<Bytef *>(Member->Data.data());
+      zs.avail_in = static_cast<uInt>(Member->Data.size());
+      zs.next_out = reinterpret_cast<Bytef *>(Packed.data());
+      zs.avail_out = static_cast<uInt>(Packed.size());
+      Ok = deflate(&zs, Z_FINISH) == Z_STREAM_END;
+      Packed.resize(zs.total_out);
+      deflateEnd(&zs);
+    }
+    {
+      std::lock_guard<std::mutex> Lock{Mutex};
+      Member->Data.swap(Packed);
+      Member->Ok = Ok;
+      Member->Done = true;
+    }
+    DoneCond.notify_all();
+  }
+}
+
+void TGzipOutput::Submit() {
+  auto Member{std::make_shared<TMember>()};
+  Chunk.resize(pptr() - pbase());
+  Member->Data.swap(Chunk);
+  Chunk.resize(ChunkSize);
+  setp(Chunk.data(), Chunk.data() + Chunk.size());
+  {
+    std::lock_guard<std::mutex> Lock{Mutex};
+    Members.push_back(Member);
+    Queue.push_back(std::move(Member));
+  }
+  NrMembers++;
+  WorkCond.notify_one();
+  WriteMembers(false);
+}
+
+void TGzipOutput::WriteMembers(const bool All) {
+  std::unique_lock<std::mutex> Lock{Mutex};
+  while (!Members.empty()) {
+    // Past the limit the formatter waits for the oldest member, which bounds the memory in flight
+    if (!Members.front()->Done) {
+      if (!All && Members.size() <= MaxPending) {
+        break;
+      }
+      DoneCond.wait(Lock, [&] { return Members.front()->Done; });
+    }
+    const std::shared_ptr<TMember> Member{Members.front()};
+    Members.pop_front();
+    Lock.unlock();
+    const auto n{static_cast<std::streamsize>(Member->Data.size())};
+    if (!Member->Ok || Dest->sputn(Member->Data.data(), n) != n) {
+      Failed = true;
+    }
+    Lock.lock();
+  }
+}
+
+TGzipOutput::int_type TGzipOutput::overflow(const int_type c) {
+  Submit();
+  if (Failed) {
+    return traits_type::eof();
+  }
+  if (!traits_type::eq_int_type(c, traits_type::eof())) {
+    *pptr() = traits_type::to_char_type(c);
+    pbump(1);
+  }
+  return traits_type::not_eof(c);
+}
+
+int TGzipOutput::sync() {
+  // Output without any text still gets one (empty) member, so it remains a valid gzip file
+  if (pptr() > pbase() || NrMembers == 0) {
+    Submit();
+  }
+  WriteMembers(true);
+  return !Failed && Dest->pubsync() == 0 ? 0 : -1;
+}
+
+void TUELCache::Build(const bool ForCSV) {
+  int NrSy, NrUel;
+  gdxSystemInfo(PGX, &NrSy, &NrUel);
+  Text.clear();
+  Start.assign(1, 0);
+  Start.reserve(NrUel + 1);
+  for (int N{1}; N <= NrUel; N++) {
+    library::ShortString s;
+    int UMap;
+    // UELs from here on are left to GetUELAsString, which counts them as bad
+    if (gdxUMUelGet(PGX, N, s.data(), &UMap) == 0) {
+      break;
+    }
+    const std::string S{s.data()};
+    if (ForCSV) {
+      const auto Q = QQCSV(S);
+      Text.insert(Text.end(), Q.begin(), Q.end());
+    } else {
+      const auto QChar = QQ(S);
+      Text.push_back(QChar);
+      Text.insert(Text.end(), S.begin(), S.end());
+      Text.push_back(QChar);
+    }
+    Start.push_back(Text.size());
+  }
+}
+
 char QQ(const std::string &s) {
   return s.find('\'') == std::string::npos ? '\'' : '\"';
 }
@@ -162,41 +362,74 @@ void WriteUELTable(const std::string &name) {
   }
 }
 
+void TValueClassifier::Build() {
+  std::array<double, GMS_SVIDX_MAX> SpecVals;
+  gdxGetSpecialValues(PGX, SpecVals.data());
+  for (int iSV{}; iSV < GMS_SVIDX_NORMAL; iSV++) {
+    std::memcpy(&SpecialBits[iSV], &SpecVals[iSV], sizeof(SpecialBits[iSV]));
+  }
+  AcrValue = SpecVals[sv_acronym];
+  AcronymNames.clear();
+  for (int N{1}; N <= gdxAcronymCount(PGX); N++) {
+    library::ShortString AName, AText;
+    int AIndx;
+    if (gdxAcronymGetInfo(PGX, N, AName.data(), AText.data(), &AIndx) != 0) {
+      // The first acronym with a given index wins, as in the library lookup
+      AcronymNames.emplace(AIndx, AName.data());
+    }
+  }
+}
+
+const std::string *TValueClassifier::AcronymName(const double V) const {
+  if (V < AcrValue) {
+    return nullptr;
+  }
+  const auto it{AcronymNames.find(utils::round<int>(V / AcrValue))};
+  return it == AcronymNames.end() ? nullptr : &it->second;
+}
+
 void WrVal(const double V) {
+  if (const std::string *Name{ValueClassifier.AcronymName(V)}) {
+    Out->Write(Name->data(), Name->length());
+    return;
+  }
   library::ShortString acrname;
-  if (gdxAcronymName(PGX, V, acrname.data()) != 0) {
-    fo << acrname.data();
+  // Only unknown acronyms are left to the library, which makes up a name for them
+  if (V >= ValueClassifier.Zvalacr() && gdxAcronymName(PGX, V, acrname.data()) != 0) {
+    Out->Write(acrname.data(), acrname.length());
   } else {
-    int iSV;
-    gdxMapValue(PGX, V, &iSV);
+    const int iSV{ValueClassifier.SpecialValue(V)};
+    auto WriteStr = [](const std::string &S) { Out->Write(S.data(), S.length()); };
     if (iSV != sv_normal) {
       if (bEpsOut && iSV == sv_valeps) {
-        fo << EpsOut;
+        WriteStr(EpsOut);
       } else if (bNaOut && iSV == sv_valna) {
-        fo << NaOut;
+        WriteStr(NaOut);
       } else if (bPinfOut && iSV == sv_valpin) {
-        fo << PinfOut;
+        WriteStr(PinfOut);
       } else if (bMinfOut && iSV == sv_valmin) {
-        fo << MinfOut;
+        WriteStr(MinfOut);
       } else if (bUndfOut && iSV == sv_valund) {
-        fo << UndfOut;
+        WriteStr(UndfOut);
       } else {
-        fo << library::specialValueStr(iSV);
+        WriteStr(library::specialValueStr(iSV));
       }
     } else if (bZeroOut && V == 0) {
-      fo << ZeroOut;
+      WriteStr(ZeroOut);
     } else {
       switch (dblFormat) {
-      case DblFormat::dbl_normal:
-        fo << gdlib::strutilx::DblToStrSep(V, DecimalSep);
+      case DblFormat::dbl_normal: {
+        std::array<char, 256> buf;
+        Out->Write(buf.data(), gdlib::strutilx::DblToStrSep(V, DecimalSep, buf.data()));
         break;
+      }
 
       case DblFormat::dbl_hexBytes:
-        fo << gdlib::dblutil::dblToStrHex(V);
+        WriteStr(gdlib::dblutil::dblToStrHex(V));
         break;
 
       case DblFormat::dbl_hexponential:
-        fo << gdlib::dblutil::dblToStrHexponential(V);
+        WriteStr(gdlib::dblutil::dblToStrHexponential(V));
         break;
 
       default:
@@ -206,7 +439,7 @@ void WrVal(const double V) {
   }
 }
 
-int BadUELs{};
+thread_local int BadUELs{};
 
 std::string GetUELAsString(const int N) {
   library::ShortString res;
@@ -222,6 +455,19 @@ std::string GetUel4CSV(const int N) {
   return QQCSV(GetUELAsString(N));
 }
 
+void WriteUELIndex(const int N) {
+  const char *s;
+  std::size_t n;
+  if (UELCache.Get(N, s, n)) {
+    Out->Write(s, n);
+  } else if (outFormat == OutFormat::fmt_csv) {
+    const auto S = GetUel4CSV(N);
+    Out->Write(S.data(), S.length());
+  } else {
+    WriteUEL(GetUELAsString(N));
+  }
+}
+
 bool WriteSymbolAsItem(const int SyNr, const bool DomInfo) {
   bool result = true;
   library::ShortString SyId;
@@ -282,6 +528,9 @@ void WriteSymbolsAsSet(const bool DomInfo) {
 }
 
 void WriteSymbol(const int SyNr) {
+  static const std::array<std::string, GMS_VAL_MAX> ValTypStrs{
+      library::valTypStr(GMS_VAL_LEVEL), library::valTypStr(GMS_VAL_MARGINAL), library::valTypStr(GMS_VAL_LOWER),
+      library::valTypStr(GMS_VAL_UPPER), library::valTypStr(GMS_VAL_SCALE)};
   library::ShortString SyName, S;
   std::string SubTypeName;
   int ADim, iATyp, ACount, AUser, IDum, NRec, FDim;
@@ -301,31 +550,31 @@ void WriteSymbol(const int SyNr) {
     if (FrstWrite) {
       FrstWrite = false;
     } else if (outFormat == OutFormat::fmt_gamsbas) {
-      fo << " ;\n";
+      Out->Write(" ;\n", 3);
     } else {
-      fo << ", ";
+      Out->Write(", ", 2);
       if ((ATyp != dt_var && ATyp != dt_equ) || ADim != 0) {
-        fo << '\n';
+        Out->Put('\n');
       }
     }
     if (outFormat == OutFormat::fmt_gamsbas) {
       if (LineCount == 6) {
         fo << "$offListing\n";
       }
-      fo << ' ' << SyName.data() << '.' << library::valTypStr(ValNr) << ' ';
+      fo << ' ' << SyName.data() << '.' << ValTypStrs[ValNr] << ' ';
     }
     if (ADim > 0) {
       if (outFormat == OutFormat::fmt_gamsbas) {
-        fo << '(';
+        Out->Put('(');
       }
       for (int D{}; D < ADim; D++) {
-        WriteUEL(GetUELAsString(Keys[D]));
+        WriteUELIndex(Keys[D]);
         if (D < ADim - 1) {
-          fo << Delim;
+          Out->Put(Delim);
         }
       }
       if (outFormat == OutFormat::fmt_gamsbas) {
-        fo << ')';
+        Out->Put(')');
       }
     }
 
@@ -338,19 +587,20 @@ void WriteSymbol(const int SyNr) {
       break;
 
     case dt_par:
-      fo << ' ';
+      Out->Put(' ');
       WrVal(Vals[ValNr]);
       break;
 
     case dt_equ:
     case dt_var:
       if (outFormat == OutFormat::fmt_gamsbas) {
-        fo << " = ";
+        Out->Write(" = ", 3);
       } else {
         if (ADim > 0) {
-          fo << Delim;
+          Out->Put(Delim);
         }
-        fo << library::valTypStr(ValNr) << ' ';
+        Out->Write(ValTypStrs[ValNr].data(), ValTypStrs[ValNr].length());
+        Out->Put(' ');
       }
       WrVal(Vals[ValNr]);
       break;
@@ -360,7 +610,10 @@ void WriteSymbol(const int SyNr) {
     }
 
     ACount--;
-    LineCount++;
+    // Only the gamsbas format counts lines; symbols of other formats may be written by several threads
+    if (outFormat == OutFormat::fmt_gamsbas) {
+      LineCount++;
+    }
   };
 
   auto WriteComments = [&]() {
@@ -556,6 +809,96 @@ void WriteSymbol(const int SyNr) {
   }
 }
 
+void WriteSymbolsParallel(const std::string &InputFile, const int NrSy) {
+  // Workers claim symbols in order and may run at most Window symbols ahead of the writer,
+  // which bounds the memory held by formatted but not yet written symbols
+  const int Window{2 * NrThreads};
+  std::mutex Mutex;
+  std::condition_variable Cond;
+  std::vector<std::string> Buffers(NrSy);
+  std::vector<bool> Done(NrSy);
+  int NextSymbol{1}, Written{}, Running{NrThreads};
+
+  auto Worker = [&]() {
+    library::ShortString error_message;
+    int ErrNr{};
+    bool Opened{gdxCreate(&PGX, error_message.data(), error_message.length()) != 0};
+    if (Opened) {
+      gdxOpenRead(PGX, InputFile.data(), &ErrNr);
+      Opened = ErrNr == 0 && gdxGetLastError(PGX) == 0;
+    }
+    if (Opened) {
+      std::stringbuf Buffer;
+      TOutputBuffer OutputBuffer{&Buffer};
+      fo.rdbuf(&OutputBuffer);
+      Out = &OutputBuffer;
+      ValueClassifier.Build();
+      while (true) {
+        int SyNr;
+        {
+          std::unique_lock<std::mutex> Lock{Mutex};
+          Cond.wait(Lock, [&] { return NextSymbol > NrSy || NextSymbol - Written <= Window; });
+          if (NextSymbol > NrSy) {
+            break;
+          }
+          SyNr = NextSymbol++;
+        }
+        WriteSymbol(SyNr);
+        fo.flush();
+        {
+          std::lock_guard<std::mutex> Lock{Mutex};
+          Buffers[SyNr - 1] = Buffer.str();
+          Done[SyNr - 1] = true;
+        }
+        Buffer.str({});
+        Cond.notify_all();
+      }
+      gdxClose(PGX);
+    }
+    if (PGX) {
+      gdxFree(&PGX);
+    }
+    {
+      std::lock_guard<std::mutex> Lock{Mutex};
+      Running--;
+    }
+    Cond.notify_all();
+  };
+
+  std::vector<std::thread> Workers;
+  Workers.reserve(NrThreads);
+  for (int N{}; N < NrThreads; N++) {
+    Workers.emplace_back(Worker);
+  }
+
+  for (int SyNr{1}; SyNr <= NrSy; SyNr++) {
+    std::string S;
+    bool Claimed{};
+    {
+      std::unique_lock<std::mutex> Lock{Mutex};
+      // Should every worker have failed to open the file, the symbol is written from this thread instead
+      Cond.wait(Lock, [&] { return Done[SyNr - 1] || (Running == 0 && NextSymbol <= SyNr); });
+      if (Done[SyNr - 1]) {
+        S = std::move(Buffers[SyNr - 1]);
+      } else {
+        NextSymbol = SyNr + 1;
+        Claimed = true;
+      }
+      Written = SyNr;
+    }
+    Cond.notify_all();
+    if (Claimed) {
+      WriteSymbol(SyNr);
+    } else {
+      Out->Write(S.data(), S.length());
+    }
+  }
+
+  for (auto &W: Workers) {
+    W.join();
+  }
+}
+
 void WriteSymbolCSV(const int SyNr) {
   int ADim;
 
@@ -599,10 +942,8 @@ void WriteSymbolCSV(const int SyNr) {
   };
 
   library::ShortString SyName, S;
-  int iATyp, NRec, FDim, IDum, Col, ColCnt, NrSymb, NrUEL, HighIndex, Indx;
+  int iATyp, NRec, FDim, IDum, Col, ColCnt, NrSymb, NrUEL;
   gdxSyType ATyp;
-  std::unique_ptr<bool[]> CSVCols;
-  std::unique_ptr<int[]> CSVUels;
   gdxUelIndex_t Keys{};
   gdxValues_t Vals{};
 
@@ -650,31 +991,31 @@ void WriteSymbolCSV(const int SyNr) {
       if (ADim == 0) {
         WrVal(Vals[GMS_VAL_LEVEL]);
         if ((ATyp == dt_var || ATyp == dt_equ) && bFullEVRec) {
-          fo << Delim;
+          Out->Put(Delim);
           WrVal(Vals[GMS_VAL_MARGINAL]);
-          fo << Delim;
+          Out->Put(Delim);
           WrVal(Vals[GMS_VAL_LOWER]);
-          fo << Delim;
+          Out->Put(Delim);
           WrVal(Vals[GMS_VAL_UPPER]);
-          fo << Delim;
+          Out->Put(Delim);
           WrVal(Vals[GMS_VAL_SCALE]);
         }
       } else {
         for (int D{}; D < ADim; D++) {
-          fo << GetUel4CSV(Keys[D]);
+          WriteUELIndex(Keys[D]);
           if (D < ADim - 1) {
-            fo << Delim;
+            Out->Put(Delim);
           } else if (ATyp != dt_set && ATyp != dt_alias) {
-            fo << Delim;
+            Out->Put(Delim);
             WrVal(Vals[GMS_VAL_LEVEL]);
             if ((ATyp == dt_var || ATyp == dt_equ) && bFullEVRec) {
-              fo << Delim;
+              Out->Put(Delim);
               WrVal(Vals[GMS_VAL_MARGINAL]);
-              fo << Delim;
+              Out->Put(Delim);
               WrVal(Vals[GMS_VAL_LOWER]);
-              fo << Delim;
+              Out->Put(Delim);
               WrVal(Vals[GMS_VAL_UPPER]);
-              fo << Delim;
+              Out->Put(Delim);
               WrVal(Vals[GMS_VAL_SCALE]);
             }
           } else if (bCSVSetText) {
@@ -682,41 +1023,26 @@ void WriteSymbolCSV(const int SyNr) {
               gdxGetElemText(PGX, utils::round<int>(Vals[GMS_VAL_LEVEL]), S.data(), &IDum);
               fo << Delim << QQCSV(S.data());
             } else {
-              fo << Delim;
+              Out->Put(Delim);
             }
           }
         }
       }
-      fo << '\n';
+      Out->Put('\n');
     }
   } else {
-    CSVCols = std::make_unique<bool[]>(NrUEL);
-    // TODO: Check this, could be redundant
-    std::fill_n(CSVCols.get(), NrUEL, false);
-    HighIndex = 0;
-    ColCnt = 0;
+    // The UELs used in the last dimension become the columns; a bitmap of them is collected in a first pass.
+    // The second pass writes each row as soon as its prefix changes, the rank of the last index in the
+    // bitmap being its column, so memory does not depend on the number of records
+    gdlib::gmsobj::TBooleanBitArray CSVCols;
+    CSVCols.SetHighIndex(NrUEL);
     gdxDataReadRawStart(PGX, SyNr, &NRec);
     while (gdxDataReadRaw(PGX, Keys, Vals, &FDim) != 0) {
-      Indx = Keys[ADim - 1];
-      if (!CSVCols[Indx - 1]) {
-        CSVCols[Indx - 1] = true;
-        ColCnt++;
-        HighIndex = std::max(HighIndex, Indx);
-      }
+      CSVCols.SetBit(Keys[ADim - 1], true);
     }
     gdxDataReadDone(PGX);
+    ColCnt = CSVCols.Count();
 
-    CSVUels = std::make_unique<int[]>(ColCnt);
-    // TODO: Check this, could be redundant
-    std::fill_n(CSVUels.get(), ColCnt, 0);
-    Col = 0;
-    for (Indx = 0; Indx < HighIndex; Indx++) {
-      if (CSVCols[Indx]) {
-        CSVUels[Col] = Indx + 1;
-        Col++;
-      }
-    }
-    library::assertWithMessage(Col == ColCnt, "Col != ColCnt");
     if (bHeader) {
       if (!Header.empty()) {
         fo << Header << '\n';
@@ -726,9 +1052,9 @@ void WriteSymbolCSV(const int SyNr) {
         fo << QQCSV(DomS[D]) << Delim;
       }
       for (Col = 0; Col < ColCnt; Col++) {
-        fo << GetUel4CSV(CSVUels[Col]);
+        WriteUELIndex(CSVCols.Select(Col));
         if (Col < ColCnt - 1) {
-          fo << Delim;
+          Out->Put(Delim);
         }
       }
       fo << '\n';
@@ -737,39 +1063,28 @@ void WriteSymbolCSV(const int SyNr) {
     bool EoFData = gdxDataReadRaw(PGX, Keys, Vals, &FDim) == 0;
     while (!EoFData) {
       for (int D{}; D < ADim - 1; D++) {
-        fo << GetUel4CSV(Keys[D]);
+        WriteUELIndex(Keys[D]);
         if (D < ADim - 2) {
-          fo << Delim;
+          Out->Put(Delim);
         }
       }
+      // Every cell, empty or not, is preceded by a delimiter
       Col = -1;
       do {
-        Indx = Keys[ADim - 1];
-        while (Col < ColCnt) {
-          Col++;
-          if (CSVUels[Col] >= Indx) {
-            break;
-          }
-          fo << Delim;
+        for (const int NewCol{CSVCols.Rank(Keys[ADim - 1])}; Col < NewCol; Col++) {
+          Out->Put(Delim);
         }
-        if (CSVUels[Col] == Indx) {
-          fo << Delim;
-          if (ATyp == dt_set || ATyp == dt_alias) {
-            fo << 'Y';
-          } else {
-            WrVal(Vals[GMS_VAL_LEVEL]);
-          }
-          EoFData = gdxDataReadRaw(PGX, Keys, Vals, &FDim) == 0;
-          if (FDim < ADim || EoFData) {
-            while (Col < ColCnt - 1) {
-              fo << Delim;
-              Col++;
-            }
-            break;
-          }
+        if (ATyp == dt_set || ATyp == dt_alias) {
+          Out->Put('Y');
+        } else {
+          WrVal(Vals[GMS_VAL_LEVEL]);
         }
-      } while (true);
-      fo << '\n';
+        EoFData = gdxDataReadRaw(PGX, Keys, Vals, &FDim) == 0;
+      } while (!EoFData && FDim == ADim);
+      for (; Col < ColCnt - 1; Col++) {
+        Out->Put(Delim);
+      }
+      Out->Put('\n');
     }
     gdxDataReadDone(PGX);
   }
@@ -778,8 +1093,240 @@ void WriteSymbolCSV(const int SyNr) {
   }
 }
 
+// Output file of one column of Format=columnar, written in little endian byte order
+class TColumnFile {
+  std::ofstream File;
+  std::vector<char> Buffer;
+
+public:
+  bool Open(const std::string &FileName) {
+    File.open(FileName, std::ios::binary);
+    Buffer.reserve(1 << 20);
+    return File.is_open();
+  }
+
+  template<typename T>
+  void Add(const T V) {
+    static const bool BigEndian{[] {
+      const std::uint16_t One{1};
+      std::uint8_t FirstByte;
+      std::memcpy(&FirstByte, &One, 1);
+      return FirstByte == 0;
+    }()};
+    std::array<char, sizeof(T)> Bytes;
+    std::memcpy(Bytes.data(), &V, sizeof(T));
+    if (BigEndian) {
+      std::reverse(Bytes.begin(), Bytes.end());
+    }
+    Buffer.insert(Buffer.end(), Bytes.begin(), Bytes.end());
+    if (Buffer.size() >= Buffer.capacity() - sizeof(T)) {
+      Flush();
+    }
+  }
+
+  void Flush() {
+    File.write(Buffer.data(), static_cast<std::streamsize>(Buffer.size()));
+    Buffer.clear();
+  }
+
+  bool Close() {
+    Flush();
+    File.close();
+    return !File.fail();
+  }
+};
+
+struct TColumnarSymbol {
+  int Dim{}, NrVals{};
+  bool IsSet{};
+  std::vector<TColumnFile> Keys, Vals;
+  TColumnFile Text;
+};
+
+static int GDX_CALLCONV StoreColumnarRecord(const int Indx[], const double Vals[], int, void *Uptr) {
+  auto &Sy = *static_cast<TColumnarSymbol *>(Uptr);
+  for (int D{}; D < Sy.Dim; D++) {
+    Sy.Keys[D].Add(static_cast<std::int32_t>(Indx[D]));
+  }
+  if (Sy.IsSet) {
+    Sy.Text.Add(static_cast<std::int32_t>(Vals[GMS_VAL_LEVEL]));
+  }
+  for (int V{}; V < Sy.NrVals; V++) {
+    Sy.Vals[V].Add(Vals[V]);
+  }
+  return 1;
+}
+
+int WriteColumnar(const std::string &Dir, const std::string &Symb) {
+  // Special values as IEEE values, the same encoding as GAMS Transfer uses
+  const std::uint64_t NaBits{0xFFFFFFFFFFFFFFFE};
+  double NaValue;
+  std::memcpy(&NaValue, &NaBits, sizeof(double));
+  gdxSVals_t SpecVals{};
+  gdxGetSpecialValues(PGX, SpecVals);
+  SpecVals[sv_valund] = std::numeric_limits<double>::quiet_NaN();
+  SpecVals[sv_valna] = NaValue;
+  SpecVals[sv_valpin] = std::numeric_limits<double>::infinity();
+  SpecVals[sv_valmin] = -std::numeric_limits<double>::infinity();
+  SpecVals[sv_valeps] = -0.0;
+  gdxSetReadSpecialValues(PGX, SpecVals);
+
+  if (!rtl::sysutils_p3::DirectoryExists(Dir) && !rtl::sysutils_p3::CreateDir(Dir)) {
+    library::printErrorMessage("Error creating output directory: " + Dir);
+    return 6;
+  }
+  const std::string Prefix{rtl::sysutils_p3::IncludeTrailingPathDelimiter(Dir)};
+
+  int NrSy, NrUel;
+  gdxSystemInfo(PGX, &NrSy, &NrUel);
+  int FirstSy{1}, LastSy{NrSy};
+  if (!Symb.empty()) {
+    if (gdxFindSymbol(PGX, Symb.data(), &FirstSy) == 0) {
+      fo << "Symbol not found: " << Symb << '\n';
+      return 6;
+    }
+    LastSy = FirstSy;
+  }
+
+  bool OK{true};
+  {
+    std::ofstream Dict{Prefix + "uels.txt", std::ios::binary};
+    for (int N{1}; N <= NrUel; N++) {
+      library::ShortString S;
+      int UMap;
+      gdxUMUelGet(PGX, N, S.data(), &UMap);
+      Dict << S.data() << '\n';
+    }
+    OK = OK && !Dict.fail();
+  }
+  int NrTexts{};
+  {
+    std::ofstream Dict{Prefix + "settexts.txt", std::ios::binary};
+    library::ShortString S;
+    int Node;
+    while (gdxGetElemText(PGX, NrTexts + 1, S.data(), &Node) != 0) {
+      Dict << S.data() << '\n';
+      NrTexts++;
+    }
+    OK = OK && !Dict.fail();
+  }
+
+  constexpr std::array TypeNames{"set", "parameter", "variable", "equation", "alias"};
+  constexpr std::array VarTypeNames{"unknown", "binary", "integer", "positive", "negative", "free", "sos1", "sos2", "semicont", "semiint"};
+  constexpr std::array EquTypeNames{"e", "g", "l", "n", "x", "c", "b"};
+  constexpr std::array ValNames{"level", "marginal", "lower", "upper", "scale"};
+
+  std::ofstream Manifest{Prefix + "manifest.json", std::ios::binary};
+  Manifest << "{\n"
+           << "  \"format\": \"gdx-columnar\",\n"
+           << "  \"version\": 1,\n"
+           << "  \"byteOrder\": \"little\",\n"
+           << "  \"uels\": {\"file\": \"uels.txt\", \"count\": " << NrUel << ", \"layout\": \"one per line, line n holds UEL n\"},\n"
+           << "  \"setTexts\": {\"file\": \"settexts.txt\", \"count\": " << NrTexts << ", \"layout\": \"one per line, line n holds text n, 0 means no text\"},\n"
+           << "  \"specialValues\": {\"undf\": \"7ff8000000000000\", \"na\": \"fffffffffffffffe\", \"+inf\": \"7ff0000000000000\", \"-inf\": \"fff0000000000000\", \"eps\": \"8000000000000000\"},\n"
+           << "  \"acronyms\": {\"encoding\": \"index * 1e301\", \"list\": [";
+  const int NrAcr{gdxAcronymCount(PGX)};
+  for (int N{1}; N <= NrAcr; N++) {
+    library::ShortString AName, AText;
+    int AIndx;
+    if (gdxAcronymGetInfo(PGX, N, AName.data(), AText.data(), &AIndx) == 0) {
+      OK = false;
+      continue;
+    }
+    Manifest << (N > 1 ? ", " : "") << "{\"name\": " << library::jsonString(AName.data()) << ", \"index\": " << AIndx << '}';
+  }
+  Manifest << "]},\n"
+           << "  \"symbols\": [";
+
+  for (int SyNr{FirstSy}; SyNr <= LastSy; SyNr++) {
+    library::ShortString SyName, SyText;
+    int SyDim, iSyTyp, SyCnt, SyUser;
+    gdxSymbolInfo(PGX, SyNr, SyName.data(), &SyDim, &iSyTyp);
+    gdxSymbolInfoX(PGX, SyNr, &SyCnt, &SyUser, SyText.data());
+    const auto SyTyp = static_cast<gdxSyType>(iSyTyp);
+
+    Manifest << (SyNr > FirstSy ? "," : "") << "\n    {\"name\": " << library::jsonString(SyName.data())
+             << ", \"type\": \"" << TypeNames[SyTyp] << '\"';
+    if (SyTyp == dt_set && SyUser == GMS_SETTYPE_SINGLETON) {
+      Manifest << ", \"subtype\": \"singleton\"";
+    } else if (SyTyp == dt_var && gmsFixVarType(SyUser) >= 0) {
+      Manifest << ", \"subtype\": \"" << VarTypeNames[gmsFixVarType(SyUser)] << '\"';
+    } else if (SyTyp == dt_equ && gmsFixEquType(SyUser) >= 0) {
+      Manifest << ", \"subtype\": \"" << EquTypeNames[gmsFixEquType(SyUser)] << '\"';
+    }
+    Manifest << ", \"dim\": " << SyDim << ", \"text\": " << library::jsonString(SyText.data());
+    if (SyTyp == dt_alias) {
+      library::ShortString AliasName{"*"};
+      if (SyUser > 0) {
+        int ADim, ATyp;
+        gdxSymbolInfo(PGX, SyUser, AliasName.data(), &ADim, &ATyp);
+      }
+      Manifest << ", \"aliasOf\": " << library::jsonString(AliasName.data()) << '}';
+      continue;
+    }
+
+    gdxStrIndex_t DomS{};
+    gdxStrIndexPtrs_t DomSPtrs;
+    GDXSTRINDEXPTRS_INIT(DomS, DomSPtrs);
+    gdxSymbolGetDomainX(PGX, SyNr, DomSPtrs);
+    Manifest << ", \"domain\": [";
+    for (int D{}; D < SyDim; D++) {
+      Manifest << (D ? ", " : "") << library::jsonString(DomSPtrs[D]);
+    }
+    Manifest << ']';
+
+    TColumnarSymbol Sy;
+    Sy.Dim = SyDim;
+    Sy.IsSet = SyTyp == dt_set;
+    Sy.NrVals = SyTyp == dt_par ? 1 : SyTyp == dt_var || SyTyp == dt_equ ? GMS_VAL_MAX : 0;
+    Sy.Keys.resize(SyDim);
+    Sy.Vals.resize(Sy.NrVals);
+    Manifest << ", \"columns\": [";
+    bool First{true};
+    auto AddColumn = [&](TColumnFile &Column, const std::string &Name, const char *Type) {
+      const std::string FileName{std::string{SyName.data()} + '.' + Name + (Type[0] == 'i' ? ".i32" : ".f64")};
+      OK = Column.Open(Prefix + FileName) && OK;
+      Manifest << (First ? "" : ", ") << "{\"name\": \"" << Name << "\", \"file\": " << library::jsonString(FileName)
+               << ", \"type\": \"" << Type << "\"}";
+      First = false;
+    };
+    for (int D{}; D < SyDim; D++) {
+      AddColumn(Sy.Keys[D], "dim" + std::to_string(D + 1), "int32");
+    }
+    if (Sy.IsSet) {
+      AddColumn(Sy.Text, "text", "int32");
+    }
+    for (int V{}; V < Sy.NrVals; V++) {
+      AddColumn(Sy.Vals[V], ValNames[V], "float64");
+    }
+    Manifest << ']';
+
+    int NrRecs{};
+    gdxDataReadRawFastEx(PGX, SyNr, StoreColumnarRecord, &NrRecs, &Sy);
+    for (auto &Column: Sy.Keys) {
+      OK = Column.Close() && OK;
+    }
+    for (auto &Column: Sy.Vals) {
+      OK = Column.Close() && OK;
+    }
+    if (Sy.IsSet) {
+      OK = Sy.Text.Close() && OK;
+    }
+    Manifest << ", \"records\": " << NrRecs << '}';
+  }
+  Manifest << "\n  ]\n"
+           << "}\n";
+  Manifest.close();
+  if (!OK || Manifest.fail()) {
+    library::printErrorMessage("Error writing columnar output to: " + Dir);
+    return 6;
+  }
+  return 0;
+}
+
 void WriteSymbolInfo() {
-  int ADim, iATyp, NrSy, NrUel, w1, w2, w3, ACount, AUserInfo;
+  int ADim, iATyp, NrSy, NrUel, w1, w2, w3, AUserInfo;
+  INT64 ACount;
   library::ShortString AName, AExplText;
   std::map<library::ShortString, int> SL;
 
@@ -789,11 +1336,11 @@ void WriteSymbolInfo() {
   w3 = static_cast<int>("Records"s.length());
   for (int N{1}; N <= NrSy; N++) {
     gdxSymbolInfo(PGX, N, AName.data(), &ADim, &iATyp);
-    gdxSymbolInfoX(PGX, N, &ACount, &AUserInfo, AExplText.data());
+    gdxSymbolInfoX64(PGX, N, &ACount, &AUserInfo, AExplText.data());
     if (static_cast<int>(AName.length()) > w2) {
       w2 = AName.length();
     }
-    w3 = std::max(w3, gdlib::strutilx::IntegerWidth(ACount));
+    w3 = std::max(w3, static_cast<int>(std::to_string(ACount).length()));
     SL.insert({AName, N});
   }
   fo << gdlib::strutilx::PadLeft(" ", w1) << ' '
@@ -805,7 +1352,7 @@ void WriteSymbolInfo() {
   int N{};
   for (const auto &pair : SL) {
     gdxSymbolInfo(PGX, pair.second, AName.data(), &ADim, &iATyp);
-    gdxSymbolInfoX(PGX, pair.second, &ACount, &AUserInfo, AExplText.data());
+    gdxSymbolInfoX64(PGX, pair.second, &ACount, &AUserInfo, AExplText.data());
     fo << gdlib::strutilx::PadLeft(std::to_string(N + 1), w1) << ' ' << gdlib::strutilx::PadRight(AName.data(), w2) << ' '
        << gdlib::strutilx::PadLeft(std::to_string(ADim), 3) << ' ' << gdlib::strutilx::PadLeft(library::gdxDataTypStr(iATyp), 4) << ' '
        << gdlib::strutilx::PadLeft(std::to_string(ACount), w3) << "  " << AExplText.data() << '\n';
@@ -916,7 +1463,7 @@ void Usage(const library::AuditLine &auditLine) {
          "gdxdump <filename> <options>\n"
          "<options>\n"
          "   -V or -Version        Write version info of input file only\n"
-         "   Output=<filename>     Write output to file\n"
+         "   Output=<filename>     Write output to file; a name ending in .gz writes gzip compressed output\n"
          "   Symb=<identifier>     Select a single identifier\n"
          "   UelTable=<identifier> Include all unique elements\n"
          "   Delim=[period, comma, tab, blank, semicolon]\n"
@@ -932,7 +1479,8 @@ void Usage(const library::AuditLine &auditLine) {
          "   SymbolsAsSet          Get a list of all symbols as data for a set\n"
          "   SymbolsAsSetDI        Get a list of all symbols as data for a set includes domain information\n"
          "   SetText               Show the list of set text (aka associated text)\n"
-         "   Format=[normal, gamsbas, csv]\n"
+         "   Format=[normal, gamsbas, csv, columnar]\n"
+         "                         columnar writes binary columns and a manifest.json into the Output directory\n"
          "   dFormat=[normal, hexponential, hexBytes]\n"
          "   CDim=[Y, N]           Use last dimension as column headers\n"
          "                         (for CSV format only; default=N)\n"
@@ -943,7 +1491,9 @@ void Usage(const library::AuditLine &auditLine) {
          "   MinfOut=<string>      String to be used when writing the value for Negative Infinity; default=-Inf\n"
          "   UndfOut=<string>      String to be used when writing the value for Undefined;         default=Undf\n"
          "   ZeroOut=<string>      String to be used when writing the value for Zero;              default=0\n"
-         "   Header=<string>       New header for CSV output format\n";
+         "   Header=<string>       New header for CSV output format\n"
+         "   Threads=<integer>     Number of threads formatting symbols when writing all symbols\n"
+         "                         and compressing .gz output; 0 uses all cores; default=1\n";
 }
 
 int ParamCount, ParamNr;
@@ -1005,6 +1555,9 @@ int main(const int argc, const char *argv[]) {
   std::string InputFile, UELSetName, OutputName;
   int ErrNr, ExitCode;
   bool ListAllSymbols, ListSymbolsAsSet, ListSymbolsAsSetDI, UsingIDE, VersionOnly, DomainInfo, showSetText;
+  // Declared first, so it is destroyed after the buffer writing into it
+  std::unique_ptr<TGzipOutput> GzipOutput;
+  std::unique_ptr<TOutputBuffer> OutputBuffer;
 
   // for (int N{}; N < argc; N++) {
   //   std::cout << "Parameter " << N << ": |" << argv[N] << "|\n";
@@ -1044,6 +1597,7 @@ int main(const int argc, const char *argv[]) {
   bHeader = false;
   bFullEVRec = false;
   bCSVSetText = false;
+  NrThreads = 1;
 
   if (ParamCount == 0) {
     // show usage
@@ -1178,6 +1732,8 @@ int main(const int argc, const char *argv[]) {
           outFormat = OutFormat::fmt_gamsbas;
         } else if (s == "CSV") {
           outFormat = OutFormat::fmt_csv;
+        } else if (s == "COLUMNAR") {
+          outFormat = OutFormat::fmt_columnar;
         } else {
           library::printErrorMessage("Unrecognized format");
           ExitCode = 1;
@@ -1284,6 +1840,18 @@ int main(const int argc, const char *argv[]) {
         bZeroOut = true;
         continue;
       }
+      if (s == "THREADS" || s == "THREADS=") {
+        s = NextParam();
+        if (!gdlib::strutilx::StrAsIntEx(s.data(), NrThreads) || NrThreads < 0) {
+          library::printErrorMessage("Invalid value for Threads parameter");
+          ExitCode = 1;
+          break;
+        }
+        if (NrThreads == 0) {
+          NrThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        }
+        continue;
+      }
       if (s == "HEADER" || s == "HEADER=") {
         Header = NextParam();
         bHeader = true;
@@ -1329,6 +1897,11 @@ int main(const int argc, const char *argv[]) {
     ExitCode = 1;
     goto End;
   }
+  if (outFormat == OutFormat::fmt_columnar && OutputName.empty()) {
+    library::printErrorMessage("Output directory not specified when writing columnar format");
+    ExitCode = 1;
+    goto End;
+  }
 
   if (!rtl::sysutils_p3::FileExists(InputFile) &&
       gdlib::strutilx::ExtractFileExtEx(InputFile).empty()) {
@@ -1365,7 +1938,12 @@ int main(const int argc, const char *argv[]) {
     }
   }
 
-  gdxOpenRead(PGX, InputFile.data(), &ErrNr);
+  // Listing symbols only needs the symbol table, so skip loading UELs and set texts
+  if (VersionOnly || ListAllSymbols || ListSymbolsAsSet || ListSymbolsAsSetDI || DomainInfo) {
+    gdxOpenReadEx(PGX, InputFile.data(), 2, &ErrNr);
+  } else {
+    gdxOpenRead(PGX, InputFile.data(), &ErrNr);
+  }
   if (ErrNr != 0) {
     gdxErrorStr(PGX, ErrNr, s.data());
     library::printErrorMessage("Problem reading GDX file: " + s);
@@ -1396,8 +1974,14 @@ int main(const int argc, const char *argv[]) {
     goto AllDone;
   }
 
+  if (outFormat == OutFormat::fmt_columnar) {
+    ExitCode = WriteColumnar(OutputName, Symb.data());
+    goto AllDone;
+  }
+
   if (!OutputName.empty()) {
-    OutputFile.open(OutputName);
+    const bool Compressed{gdlib::strutilx::StrUEqual(gdlib::strutilx::ExtractFileExtEx(OutputName), ".gz")};
+    OutputFile.open(OutputName, Compressed ? std::ios::out | std::ios::binary : std::ios::out);
     if (!OutputFile.is_open()) {
       ErrNr = errno;
       library::printErrorMessage("Error opening output file: " + OutputName);
@@ -1406,7 +1990,14 @@ int main(const int argc, const char *argv[]) {
       goto End;
     }
     fo.rdbuf(OutputFile.rdbuf());
+    if (Compressed) {
+      GzipOutput = std::make_unique<TGzipOutput>(OutputFile.rdbuf(), NrThreads);
+      fo.rdbuf(GzipOutput.get());
+    }
   }
+  OutputBuffer = std::make_unique<TOutputBuffer>(fo.rdbuf());
+  fo.rdbuf(OutputBuffer.get());
+  Out = OutputBuffer.get();
 
   if (!ShowData) {
     fo << "\n$gdxIn " << InputFile << '\n';
@@ -1443,6 +2034,20 @@ int main(const int argc, const char *argv[]) {
     goto AllDone;
   }
 
+  if (ShowData) {
+    // Rendering all UELs up front pays off unless a single symbol with few records is written
+    int NrSy, NrUel, SyNr, SyCnt{}, SyUser;
+    library::ShortString SyText;
+    gdxSystemInfo(PGX, &NrSy, &NrUel);
+    if (!Symb.empty() && gdxFindSymbol(PGX, Symb.data(), &SyNr) != 0) {
+      gdxSymbolInfoX(PGX, SyNr, &SyCnt, &SyUser, SyText.data());
+    }
+    if (Symb.empty() || SyCnt >= NrUel) {
+      UELCache.Build(outFormat == OutFormat::fmt_csv);
+    }
+  }
+  ValueClassifier.Build();
+
   LineCount = 0;
   if (!Symb.empty()) {
     int N;
@@ -1470,8 +2075,13 @@ int main(const int argc, const char *argv[]) {
     }
     int NrSy, NrUel;
     gdxSystemInfo(PGX, &NrSy, &NrUel);
-    for (int N{1}; N <= NrSy; N++) {
-      WriteSymbol(N);
+    // The gamsbas format counts lines across symbols, so it is always written serially
+    if (NrThreads > 1 && NrSy > 1 && outFormat == OutFormat::fmt_normal) {
+      WriteSymbolsParallel(InputFile, NrSy);
+    } else {
+      for (int N{1}; N <= NrSy; N++) {
+        WriteSymbol(N);
+      }
     }
     fo << "\n$offEmpty\n";
   }
@@ -1480,6 +2090,11 @@ int main(const int argc, const char *argv[]) {
   }
 
 AllDone:
+  fo.flush();
+  if (GzipOutput && !GzipOutput->Ok()) {
+    library::printErrorMessage("Error writing output file: " + OutputName);
+    ExitCode = 6;
+  }
   gdxClose(PGX);
   gdxFree(&PGX);
 
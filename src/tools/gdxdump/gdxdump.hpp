@@ -1,19 +1,32 @@
 #pragma once
 
 #include <array>
+#include <condition_variable>
 #include <cstdint>
+#include <cstring>
+#include <deque>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <streambuf>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include "library/common.hpp"
 
+// Global constants
+#include "generated/gclgms.h"
+
 namespace gdxdump {
 
 enum class OutFormat : std::uint8_t {
   fmt_none,
   fmt_normal,
   fmt_gamsbas,
-  fmt_csv
+  fmt_csv,
+  fmt_columnar
 };
 
 enum class DblFormat : std::uint8_t {
@@ -23,6 +36,121 @@ enum class DblFormat : std::uint8_t {
   dbl_hexBytes
 };
 
+// Large buffer in front of the real output; fo writes through it and the record loops append to it directly
+class TOutputBuffer final : public std::streambuf {
+  std::streambuf *Dest;
+  std::vector<char> Buffer;
+
+  bool FlushBuffer();
+
+protected:
+  int_type overflow(int_type c) override;
+  std::streamsize xsputn(const char *s, std::streamsize n) override;
+  int sync() override;
+
+public:
+  explicit TOutputBuffer(std::streambuf *Dest, std::size_t Size = 256 * 1024);
+  ~TOutputBuffer() override;
+
+  void Put(const char c) {
+    if (pptr() < epptr()) {
+      *pptr() = c;
+      pbump(1);
+    } else {
+      overflow(static_cast<unsigned char>(c));
+    }
+  }
+
+  void Write(const char *s, const std::size_t n) {
+    if (n <= static_cast<std::size_t>(epptr() - pptr())) {
+      std::memcpy(pptr(), s, n);
+      pbump(static_cast<int>(n));
+    } else {
+      xsputn(s, static_cast<std::streamsize>(n));
+    }
+  }
+};
+
+// Output for Output=<file>.gz: the text is cut into chunks that worker threads deflate into separate gzip
+// members while the formatter goes on; a gzip reader decompresses the concatenated members as one stream
+class TGzipOutput final : public std::streambuf {
+  struct TMember {
+    std::vector<char> Data;
+    bool Done{}, Ok{};
+  };
+
+  std::streambuf *Dest;
+  std::vector<char> Chunk;
+  std::deque<std::shared_ptr<TMember>> Members, Queue;
+  std::mutex Mutex;
+  std::condition_variable WorkCond, DoneCond;
+  std::vector<std::thread> Workers;
+  std::size_t MaxPending, NrMembers{};
+  bool Stopping{}, Failed{};
+
+  void Compress();
+  void Submit();
+  void WriteMembers(bool All);
+
+protected:
+  int_type overflow(int_type c) override;
+  int sync() override;
+
+public:
+  static constexpr std::size_t ChunkSize{1024 * 1024};
+
+  TGzipOutput(std::streambuf *Dest, int NrWorkers);
+  ~TGzipOutput() override;
+
+  [[nodiscard]] bool Ok() const {
+    return !Failed;
+  }
+};
+
+// Written form of every UEL for the selected output format, stored back to back
+class TUELCache {
+  std::vector<char> Text;
+  std::vector<std::size_t> Start;
+
+public:
+  void Build(bool ForCSV);
+  bool Get(int N, const char *&s, std::size_t &n) const {
+    if (N < 1 || N >= static_cast<int>(Start.size())) {
+      return false;
+    }
+    s = Text.data() + Start[N - 1];
+    n = Start[N] - Start[N - 1];
+    return true;
+  }
+};
+
+// Classification of values for WrVal, set up once per GDX handle: special values are matched
+// on their bit pattern and acronym names are looked up by index instead of asking the library
+class TValueClassifier {
+  std::array<std::uint64_t, GMS_SVIDX_NORMAL> SpecialBits{};
+  double AcrValue{};
+  std::unordered_map<int, std::string> AcronymNames;
+
+public:
+  void Build();
+  double Zvalacr() const {
+    return AcrValue;
+  }
+  // Returns the acronym name for V or nullptr when V is not a known acronym
+  const std::string *AcronymName(double V) const;
+  // Returns sv_normal or the index of the special value V stands for
+  int SpecialValue(double V) const {
+    std::uint64_t Bits;
+    std::memcpy(&Bits, &V, sizeof(Bits));
+    for (int iSV{}; iSV < GMS_SVIDX_NORMAL; iSV++) {
+      if (Bits == SpecialBits[iSV]) {
+        return iSV;
+      }
+    }
+    return sv_normal;
+  }
+};
+
 char QQ(const std::string &s);
 
 std::string QQCSV(const std::string &s);
@@ -47,14 +175,20 @@ std::string GetUELAsString(int N);
 
 std::string GetUel4CSV(int N);
 
+void WriteUELIndex(int N);
+
 bool WriteSymbolAsItem(int SyNr, bool DomInfo);
 
 void WriteSymbolsAsSet(bool DomInfo);
 
 void WriteSymbol(int SyNr);
 
+void WriteSymbolsParallel(const std::string &InputFile, int NrSy);
+
 void WriteSymbolCSV(int SyNr);
 
+int WriteColumnar(const std::string &Dir, const std::string &Symb);
+
 void WriteSymbolInfo();
 
 void WriteDomainInfo();
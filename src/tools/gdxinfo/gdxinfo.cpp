@@ -0,0 +1,392 @@
+/**
+ * GAMS - General Algebraic Modeling System C++ API
+ *
+ * Copyright (c) 2017-2026 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2026 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "gdlib/strutilx.hpp"
+#include "gdxinfo.hpp"
+#include "library/cmdpar.hpp"
+#include "library/short_string.hpp"
+#include "rtl/sysutils_p3.hpp"
+
+// Global constants
+#include "generated/gclgms.h"
+
+namespace gdxinfo {
+
+CatalogFormat catalogFormat;
+
+// Columns of the CSV catalog, every row has one field per column; the first FileColumns describe the file
+constexpr std::array CsvColumns{"File", "FileVersion", "Producer", "FileFormat", "Compression", "UELs", "Symbol", "Type", "Dim", "Records", "Domain", "Text", "Error"};
+constexpr std::size_t FileColumns{6};
+
+// Standard output may carry the catalog, so messages go to standard error
+void ErrorMessage(const std::string &Msg) {
+  std::cerr << Msg << '\n';
+}
+
+std::string CsvString(const std::string &S) {
+  std::string res{'\"'};
+  for (const char c: S) {
+    if (c == '\"') {
+      res += '\"';
+    }
+    res += c;
+  }
+  return res + '\"';
+}
+
+bool CollectFiles(const std::string &Path, std::vector<std::string> &Files) {
+  namespace fs = std::filesystem;
+  std::error_code ec;
+  if (fs::is_directory(Path, ec)) {
+    // Sorted, so the catalog of a directory does not depend on the order the file system lists it in
+    const std::size_t First{Files.size()};
+    for (fs::recursive_directory_iterator it{Path, fs::directory_options::skip_permission_denied, ec}, end; !ec && it != end; it.increment(ec)) {
+      std::error_code ecFile;
+      if (it->is_regular_file(ecFile) && gdlib::strutilx::StrUEqual(it->path().extension().string(), ".gdx")) {
+        Files.push_back(it->path().string());
+      }
+    }
+    std::sort(Files.begin() + static_cast<std::ptrdiff_t>(First), Files.end());
+    return !ec;
+  }
+  std::string FileName{Path};
+  if (!rtl::sysutils_p3::FileExists(FileName) && gdlib::strutilx::ExtractFileExtEx(FileName).empty()) {
+    FileName = gdlib::strutilx::ChangeFileExtEx(FileName, ".gdx");
+  }
+  if (!rtl::sysutils_p3::FileExists(FileName)) {
+    return false;
+  }
+  Files.push_back(FileName);
+  return true;
+}
+
+std::string CatalogFile(const gdxHandle_t &PGX, const std::string &FileName, bool &Ok) {
+  std::ostringstream Entry;
+  int ErrNr;
+  // Only the symbol table is used, so the UEL, set text and acronym sections are never read
+  gdxOpenReadEx(PGX, FileName.data(), 3, &ErrNr);
+  if (ErrNr == 0) {
+    ErrNr = gdxGetLastError(PGX);
+  }
+  Ok = ErrNr == 0;
+  if (!Ok) {
+    library::ShortString Msg;
+    gdxErrorStr(PGX, ErrNr, Msg.data());
+    gdxClose(PGX);
+    if (catalogFormat == CatalogFormat::cf_csv) {
+      Entry << CsvString(FileName) << std::string(CsvColumns.size() - 1, ',') << CsvString(Msg.data()) << '\n';
+    } else {
+      Entry << "  {\"file\": " << library::jsonString(FileName) << ", \"error\": " << library::jsonString(Msg.data()) << '}';
+    }
+    return Entry.str();
+  }
+
+  library::ShortString FileStr, ProduceStr;
+  gdxFileVersion(PGX, FileStr.data(), ProduceStr.data());
+  int NrSy, NrUel, FileVer, ComprLev;
+  gdxSystemInfo(PGX, &NrSy, &NrUel);
+  gdxFileInfo(PGX, &FileVer, &ComprLev);
+
+  // The columns up to and including the UEL count are the same for every symbol of a file
+  std::string FileFields;
+  if (catalogFormat == CatalogFormat::cf_csv) {
+    FileFields = CsvString(FileName) + ',' + CsvString(FileStr.data()) + ',' + CsvString(ProduceStr.data()) + ',' + std::to_string(FileVer) + ',' + std::to_string(ComprLev) + ',' + std::to_string(NrUel) + ',';
+    if (NrSy == 0) {
+      Entry << FileFields << std::string(CsvColumns.size() - FileColumns - 1, ',') << '\n';
+    }
+  } else {
+    Entry << "  {\"file\": " << library::jsonString(FileName)
+          << ", \"fileVersion\": " << library::jsonString(FileStr.data())
+          << ", \"producer\": " << library::jsonString(ProduceStr.data())
+          << ", \"fileFormat\": " << FileVer
+          << ", \"compression\": " << ComprLev
+          << ", \"uels\": " << NrUel
+          << ", \"symbols\": [";
+  }
+
+  for (int SyNr{1}; SyNr <= NrSy; SyNr++) {
+    library::ShortString SyName, SyText;
+    int SyDim, SyTyp, SyUser;
+    INT64 SyCnt;
+    gdxSymbolInfo(PGX, SyNr, SyName.data(), &SyDim, &SyTyp);
+    gdxSymbolInfoX64(PGX, SyNr, &SyCnt, &SyUser, SyText.data());
+
+    gdxStrIndex_t DomainIDs;
+    gdxStrIndexPtrs_t DomainIDsPtrs;
+    GDXSTRINDEXPTRS_INIT(DomainIDs, DomainIDsPtrs);
+    gdxSymbolGetDomainX(PGX, SyNr, DomainIDsPtrs);
+
+    if (catalogFormat == CatalogFormat::cf_csv) {
+      std::string Domain;
+      for (int D{}; D < SyDim; D++) {
+        if (D) {
+          Domain += ',';
+        }
+        Domain += DomainIDsPtrs[D];
+      }
+      Entry << FileFields << CsvString(SyName.data()) << ',' << library::gdxDataTypStrL(SyTyp) << ',' << SyDim << ',' << SyCnt << ','
+            << CsvString(Domain) << ',' << CsvString(SyText.data()) << ",\n";
+    } else {
+      Entry << (SyNr > 1 ? "," : "") << "\n    {\"name\": " << library::jsonString(SyName.data())
+            << ", \"type\": \"" << library::gdxDataTypStrL(SyTyp) << '\"'
+            << ", \"dim\": " << SyDim
+            << ", \"records\": " << SyCnt
+            << ", \"domain\": [";
+      for (int D{}; D < SyDim; D++) {
+        Entry << (D ? ", " : "") << library::jsonString(DomainIDsPtrs[D]);
+      }
+      Entry << "], \"text\": " << library::jsonString(SyText.data()) << '}';
+    }
+  }
+  if (catalogFormat == CatalogFormat::cf_json) {
+    Entry << (NrSy > 0 ? "\n  " : "") << "]}";
+  }
+
+  gdxClose(PGX);
+  return Entry.str();
+}
+
+void Usage(const library::AuditLine &auditLine) {
+  std::cout
+      << "gdxinfo: Catalog the symbols of GDX files\n"
+      << auditLine.getAuditLine()
+      << "\n\nUsage:\n"
+         "   gdxinfo path1 path2 ... pathn\n"
+         "     Optional parameters:\n"
+         "          format=csv|json  : Format of the catalog; csv by default\n"
+         "          output=filename  : Write the catalog to a file instead of standard output\n"
+         "          threads=<integer>: Number of files read at the same time; 0 (default) uses all cores\n"
+         "Path represents a GDX file or a directory that is searched for .gdx files, including subdirectories.\n"
+         "The form: @filename will process parameters from that file\n";
+}
+
+int main(const int argc, const char *argv[]) {
+  library::ShortString Msg;
+
+  library::AuditLine auditLine{"GDXINFO"};
+  if (argc > 1 && gdlib::strutilx::StrUEqual(argv[1], "AUDIT")) {
+    std::cout << auditLine.getAuditLine() << '\n';
+    return {};
+  }
+
+  if (argc == 1 || (argc == 2 && std::strcmp(argv[1], "/?") == 0)) {
+    Usage(auditLine);
+    return static_cast<int>(ErrorCode::ERR_USAGE);
+  }
+
+  auto CmdParams{std::make_unique<library::cmdpar::CmdParams>()};
+  CmdParams->AddParam(static_cast<int>(KP::Output), "Output");
+  CmdParams->AddParam(static_cast<int>(KP::Output), "O");
+  CmdParams->AddParam(static_cast<int>(KP::Format), "Format");
+  CmdParams->AddParam(static_cast<int>(KP::Threads), "Threads");
+
+  if (!CmdParams->CrackCommandLine(argc, argv)) {
+    ErrorMessage("*** Error: Parameter error");
+    return static_cast<int>(ErrorCode::ERR_USAGE);
+  }
+
+  std::string OutFile;
+  std::vector<std::string> Paths;
+  int NrThreads{};
+  catalogFormat = CatalogFormat::cf_csv;
+  for (int ParNr{}; ParNr < CmdParams->GetParamCount(); ParNr++) {
+    const library::cmdpar::ParamRec paramRec{CmdParams->GetParams(ParNr)};
+    switch (static_cast<KP>(paramRec.Key)) {
+    case KP::Output:
+      OutFile = paramRec.KeyS;
+      break;
+
+    case KP::Format:
+      if (gdlib::strutilx::StrUEqual(paramRec.KeyS, "csv")) {
+        catalogFormat = CatalogFormat::cf_csv;
+      } else if (gdlib::strutilx::StrUEqual(paramRec.KeyS, "json")) {
+        catalogFormat = CatalogFormat::cf_json;
+      } else {
+        ErrorMessage("*** Error: Unrecognized format: " + paramRec.KeyS);
+        return static_cast<int>(ErrorCode::ERR_USAGE);
+      }
+      break;
+
+    case KP::Threads:
+      if (!gdlib::strutilx::StrAsIntEx(paramRec.KeyS, NrThreads) || NrThreads < 0) {
+        ErrorMessage("*** Error: Invalid value for Threads parameter");
+        return static_cast<int>(ErrorCode::ERR_USAGE);
+      }
+      break;
+
+    default:
+      Paths.push_back(paramRec.KeyS);
+    }
+  }
+
+  if (Paths.empty()) {
+    Usage(auditLine);
+    return static_cast<int>(ErrorCode::ERR_USAGE);
+  }
+
+  if (gdxGetReady(Msg.data(), Msg.length()) == 0) {
+    ErrorMessage("*** Error: Unable to load gdx library, message:\n" + Msg);
+    return static_cast<int>(ErrorCode::ERR_LOADDLL);
+  }
+
+  int ExitCode{};
+  std::vector<std::string> Files;
+  for (const std::string &Path: Paths) {
+    if (!CollectFiles(Path, Files)) {
+      ErrorMessage("*** Error: Cannot read \"" + Path + '\"');
+      ExitCode = static_cast<int>(ErrorCode::ERR_READGDX);
+    }
+  }
+
+  std::ofstream OutputFile;
+  if (!OutFile.empty()) {
+    OutputFile.open(OutFile);
+    if (!OutputFile.is_open()) {
+      ErrorMessage("*** Error: Cannot write to output file \"" + OutFile + '\"');
+      return static_cast<int>(ErrorCode::ERR_WRITE);
+    }
+  }
+  std::ostream &fo{OutFile.empty() ? std::cout : OutputFile};
+
+  if (NrThreads == 0) {
+    NrThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  }
+  NrThreads = std::max(1, std::min(NrThreads, static_cast<int>(Files.size())));
+
+  // Every thread reads through its own handle, created here so a failure is reported once
+  std::vector<gdxHandle_t> Handles(NrThreads);
+  for (gdxHandle_t &PGX: Handles) {
+    if (gdxCreate(&PGX, Msg.data(), Msg.length()) == 0) {
+      ErrorMessage("*** Error: Unable to create gdx object, message:\n" + Msg);
+      for (gdxHandle_t &Created: Handles) {
+        if (Created) {
+          gdxFree(&Created);
+        }
+      }
+      return static_cast<int>(ErrorCode::ERR_LOADDLL);
+    }
+  }
+
+  // Files are claimed in order and the entries are written in that order as soon as they are ready,
+  // so the catalog only holds the entries that finished ahead of the next one to be written
+  std::mutex Mutex;
+  std::condition_variable Cond;
+  std::vector<std::string> Entries(Files.size());
+  std::vector<bool> Done(Files.size());
+  std::size_t NextFile{};
+  int BadFiles{};
+
+  auto Worker = [&](const gdxHandle_t PGX) {
+    while (true) {
+      std::size_t N;
+      {
+        std::lock_guard<std::mutex> Lock{Mutex};
+        if (NextFile >= Files.size()) {
+          break;
+        }
+        N = NextFile++;
+      }
+      bool Ok;
+      std::string Entry{CatalogFile(PGX, Files[N], Ok)};
+      {
+        std::lock_guard<std::mutex> Lock{Mutex};
+        Entries[N] = std::move(Entry);
+        Done[N] = true;
+        if (!Ok) {
+          BadFiles++;
+        }
+      }
+      Cond.notify_all();
+    }
+  };
+
+  std::vector<std::thread> Workers;
+  Workers.reserve(NrThreads);
+  for (const gdxHandle_t PGX: Handles) {
+    Workers.emplace_back(Worker, PGX);
+  }
+
+  if (catalogFormat == CatalogFormat::cf_csv) {
+    for (std::size_t C{}; C < CsvColumns.size(); C++) {
+      fo << (C ? "," : "") << CsvString(CsvColumns[C]);
+    }
+    fo << '\n';
+  } else {
+    fo << '[';
+  }
+  for (std::size_t N{}; N < Files.size(); N++) {
+    std::string Entry;
+    {
+      std::unique_lock<std::mutex> Lock{Mutex};
+      Cond.wait(Lock, [&] { return static_cast<bool>(Done[N]); });
+      Entry = std::move(Entries[N]);
+    }
+    if (catalogFormat == CatalogFormat::cf_json) {
+      fo << (N ? ",\n" : "\n");
+    }
+    fo << Entry;
+  }
+  if (catalogFormat == CatalogFormat::cf_json) {
+    fo << (Files.empty() ? "]\n" : "\n]\n");
+  }
+
+  for (std::thread &T: Workers) {
+    T.join();
+  }
+  for (gdxHandle_t &PGX: Handles) {
+    gdxFree(&PGX);
+  }
+
+  fo.flush();
+  if (!fo) {
+    ErrorMessage("*** Error: Writing the catalog failed");
+    return static_cast<int>(ErrorCode::ERR_WRITE);
+  }
+  if (BadFiles > 0) {
+    ErrorMessage("*** Error: " + std::to_string(BadFiles) + " of " + std::to_string(Files.size()) + " files could not be read");
+    ExitCode = static_cast<int>(ErrorCode::ERR_READGDX);
+  }
+  return ExitCode;
+}
+
+} // namespace gdxinfo
+
+int main(const int argc, const char *argv[]) {
+  return gdxinfo::main(argc, argv);
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "library/common.hpp"
+
+// GDX library interface
+#include "generated/gdxcc.h"
+
+namespace gdxinfo {
+
+enum class ErrorCode : std::uint8_t {
+  ERR_USAGE = 1,
+  ERR_LOADDLL,
+  ERR_WRITE,
+  ERR_READGDX
+};
+
+enum class KP : std::uint8_t {
+  Output = 1,
+  Format,
+  Threads
+};
+
+enum class CatalogFormat : std::uint8_t {
+  cf_csv,
+  cf_json
+};
+
+void ErrorMessage(const std::string &Msg);
+
+std::string CsvString(const std::string &S);
+
+bool CollectFiles(const std::string &Path, std::vector<std::string> &Files);
+
+std::string CatalogFile(const gdxHandle_t &PGX, const std::string &FileName, bool &Ok);
+
+void Usage(const library::AuditLine &auditLine);
+
+int main(int argc, const char *argv[]);
+
+} // namespace gdxinfo
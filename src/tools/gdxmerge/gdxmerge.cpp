@@ -155,7 +155,7 @@ void SymbolList::AddPGXFile(const int FNr, const ProcessPass Pass) {
   };
 
   gdxHandle_t PGX;
-  int NrSy, NrUel, N, Dim, SyITyp, SyIndx, NrRecs, FDim, D, INode, SySubTyp, DummyCount, ErrNr, RecLen;
+  int NrSy, NrUel, N, Dim, SyITyp, SyIndx, NrRecs, FDim, D, INode, SySubTyp, ErrNr, RecLen;
   gdxSyType SyTyp;
   GAMSSymbol *SyObj;
 
@@ -166,7 +166,8 @@ void SymbolList::AddPGXFile(const int FNr, const ProcessPass Pass) {
   gdxUelIndex_t IndxI{};
   gdxValues_t Vals{};
   library::ShortString Txt, SyText, ErrMsg, FileId;
-  std::int64_t XCount, Size;
+  INT64 XCount;
+  std::int64_t Size;
 
   FileName = fileList->FileName(FNr);
   FileId = fileList->FileId(FNr);
@@ -189,7 +190,7 @@ void SymbolList::AddPGXFile(const int FNr, const ProcessPass Pass) {
 
   for (N = 1; N <= NrSy; N++) {
     gdxSymbolInfo(PGX, N, SyName.data(), &Dim, &SyITyp);
-    gdxSymbolInfoX(PGX, N, &DummyCount, &SySubTyp, SyText.data());
+    gdxSymbolInfoX64(PGX, N, &XCount, &SySubTyp, SyText.data());
     if (CheckError(Dim < GMS_MAX_INDEX_DIM, "Dimension too large")) {
       continue;
     }
@@ -215,7 +216,6 @@ void SymbolList::AddPGXFile(const int FNr, const ProcessPass Pass) {
     }
 
     // 64 bit
-    XCount = static_cast<std::int64_t>(DummyCount);
     Size = XCount * SyObj->SyDim;
     if (SyTyp == dt_var || SyTyp == dt_equ) {
       RecLen = 4;
@@ -233,14 +233,6 @@ void SymbolList::AddPGXFile(const int FNr, const ProcessPass Pass) {
               (SyObj->SyDim * sizeof(int)) +
               (RecLen * sizeof(double)));
 
-      if (CheckError(
-              SyObj->SyData->GetCount() + XCount <= std::numeric_limits<int>::max(),
-              "Element count for symbol > maxint")) {
-        SyObj->SySkip = true;
-        SyObj->SyData.reset();
-        continue;
-      }
-
 #if defined(OLD_MEMORY_CHECK)
       if (CheckError(
               SyObj->SyMemory <= std::numeric_limits<int>::max(),
@@ -406,7 +398,8 @@ bool SymbolList::FindGDXFiles(const std::string &Path) {
 
 void SymbolList::WritePGXFile(const int SyNr, const ProcessPass Pass) {
   GAMSSymbol *SyObj;
-  int R, INode;
+  std::int64_t R;
+  int INode;
   gdxUelIndex_t IndxI{};
   gdxValues_t Vals{};
   library::ShortString Txt;
@@ -1,5 +1,6 @@
 #include <array>
 #include <cassert>
+#include <cstdio>
 #include <ctime>
 #include <iomanip>
 #include <iostream>
@@ -164,6 +165,23 @@ bool goodUELString(const char *s, const std::size_t slen) {
   return slen < GLOBAL_UEL_IDENT_SIZE && canBeQuoted(s, slen);
 }
 
+std::string jsonString(const std::string &s) {
+  std::string res{'\"'};
+  for (const char c: s) {
+    if (c == '\"' || c == '\\') {
+      res += '\\';
+      res += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      std::array<char, 8> buf;
+      std::snprintf(buf.data(), buf.size(), "\\u%04x", c);
+      res += buf.data();
+    } else {
+      res += c;
+    }
+  }
+  return res + '\"';
+}
+
 void AuditLine::setAuditLine() {
   std::string
       GDL_REL_PLT,
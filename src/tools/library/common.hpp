@@ -30,6 +30,8 @@ bool canBeQuoted(const char *s, std::size_t slen);
 
 bool goodUELString(const char *s, std::size_t slen);
 
+std::string jsonString(const std::string &s);
+
 class AuditLine {
   std::string
       system_name,
@@ -6,6 +6,7 @@ import gams  # type: ignore
 
 from .gdxdiff import TestGdxDiff
 from .gdxdump import TestGdxDump
+from .gdxinfo import TestGdxInfo
 from .gdxmerge import TestGdxMerge
 
 
@@ -40,10 +41,14 @@ def main() -> int:
             case "gdxmerge" | "merge":
                 suite.addTests(loader.loadTestsFromTestCase(TestGdxMerge))
 
+            case "gdxinfo" | "info":
+                suite.addTests(loader.loadTestsFromTestCase(TestGdxInfo))
+
             case _:
                 suite.addTests(loader.loadTestsFromTestCase(TestGdxDump))
                 suite.addTests(loader.loadTestsFromTestCase(TestGdxDiff))
                 suite.addTests(loader.loadTestsFromTestCase(TestGdxMerge))
+                suite.addTests(loader.loadTestsFromTestCase(TestGdxInfo))
 
         return suite
 
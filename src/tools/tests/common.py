@@ -15,6 +15,7 @@ class OutputPaths:
     gdxdump: Path
     gdxdiff: Path
     gdxmerge: Path
+    gdxinfo: Path
 
 
 @dataclass(frozen=True)
@@ -39,12 +40,13 @@ DIRECTORY_PATHS = DirectoryPaths(
         gdxdump=TESTS_DIRECTORY_PATH / "output" / "gdxdump",
         gdxdiff=TESTS_DIRECTORY_PATH / "output" / "gdxdiff",
         gdxmerge=TESTS_DIRECTORY_PATH / "output" / "gdxmerge",
+        gdxinfo=TESTS_DIRECTORY_PATH / "output" / "gdxinfo",
     ),
     results=TESTS_DIRECTORY_PATH / "results",
 )
 
 
-type ExecutableName = Literal["gdxdump", "gdxdiff", "gdxmerge"]
+type ExecutableName = Literal["gdxdump", "gdxdiff", "gdxmerge", "gdxinfo"]
 
 
 def get_executable_path(executable_name: ExecutableName) -> Path:
@@ -0,0 +1,35 @@
+import os
+from pathlib import Path
+
+from gams.core import gdx  # type: ignore
+
+
+def create_acronym_example(file_path: Path) -> None:
+    # GAMS Transfer does not write acronyms, so use the low-level GDX API
+    handle = gdx.new_gdxHandle_tp()
+    system_directory = os.environ.get("GAMS_SYSTEM_DIRECTORY")
+    if system_directory is None:
+        gdx.gdxCreate(handle, gdx.GMS_SSSIZE)
+    else:
+        gdx.gdxCreateD(handle, system_directory, gdx.GMS_SSSIZE)
+
+    gdx.gdxOpenWrite(handle, str(file_path), "acronym_example")
+
+    # declare the acronyms before they are used as values
+    gdx.gdxAcronymAdd(handle, "first", "first acronym", 1)
+    gdx.gdxAcronymAdd(handle, "second", "second acronym", 2)
+
+    # add 'p' parameter with a regular value and two acronym values
+    gdx.gdxDataWriteStrStart(handle, "p", "capacity class", 1, gdx.GMS_DT_PAR, 0)
+    for label, value in [
+        ("seattle", 350.0),
+        ("san-diego", gdx.gdxAcronymValue(handle, 1)),
+        ("topeka", gdx.gdxAcronymValue(handle, 2)),
+    ]:
+        values = [0.0] * gdx.GMS_VAL_MAX
+        values[gdx.GMS_VAL_LEVEL] = value
+        gdx.gdxDataWriteStr(handle, [label], values)
+    gdx.gdxDataWriteDone(handle)
+
+    gdx.gdxClose(handle)
+    gdx.gdxFree(handle)
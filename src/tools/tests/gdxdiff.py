@@ -1,4 +1,5 @@
 import os
+import shutil
 import subprocess
 import unittest
 from pathlib import Path
@@ -38,6 +39,7 @@ class TestGdxDiff(unittest.TestCase):
     FILE_NAMES = [
         "small_example",
         "full_example",
+        "full_example_copy",
         "small_example_changed_data",
         "full_example_changed_variables",
         "full_example_changed_data_and_variables",
@@ -62,6 +64,9 @@ class TestGdxDiff(unittest.TestCase):
 
         create_small_example(cls.FILE_PATHS["small_example"])
         create_full_example(cls.FILE_PATHS["full_example"])
+        shutil.copyfile(
+            cls.FILE_PATHS["full_example"], cls.FILE_PATHS["full_example_copy"]
+        )
         create_small_example_changed_data(cls.FILE_PATHS["small_example_changed_data"])
         create_full_example_changed_variables(
             cls.FILE_PATHS["full_example_changed_variables"]
@@ -560,6 +565,73 @@ class TestGdxDiff(unittest.TestCase):
         }
         self.check_gdx_file(symbols)
 
+    def test_full_example_and_full_example_changed_data_and_variables_threads(
+        self,
+    ) -> None:
+        output = self.run_gdxdiff(
+            [
+                self.FILE_PATHS["full_example"],
+                self.FILE_PATHS["full_example_changed_data_and_variables"],
+                self.FILE_PATHS["diff_file"],
+                "Threads=4",
+            ]
+        )
+        self.check_output(
+            output,
+            return_code=1,
+            file_name="full_example_and_full_example_changed_data_and_variables.txt",
+            first_offset=3,
+            second_offset=3,
+            first_delete=[-3],
+            second_delete=[-3],
+        )
+
+        symbols: GamsSymbols = {
+            "c": [
+                ["seattle", "new-york", "dif1", 0.225],
+                ["seattle", "new-york", "dif2", 0.315],
+                ["seattle", "chicago", "dif1", 0.153],
+                ["seattle", "chicago", "dif2", 0.24300000000000002],
+                ["seattle", "topeka", "dif1", 0.162],
+                ["seattle", "topeka", "dif2", 0.25199999999999995],
+                ["san-diego", "new-york", "dif1", 0.225],
+                ["san-diego", "new-york", "dif2", 0.315],
+                ["san-diego", "chicago", "dif1", 0.162],
+                ["san-diego", "chicago", "dif2", 0.25199999999999995],
+                ["san-diego", "topeka", "dif1", 0.12599999999999997],
+                ["san-diego", "topeka", "dif2", 0.216],
+            ],
+            "d": [
+                ["seattle", "new-york", "dif1", 2.5],
+                ["seattle", "new-york", "dif2", 3.5],
+                ["seattle", "chicago", "dif1", 1.7],
+                ["seattle", "chicago", "dif2", 2.7],
+                ["seattle", "topeka", "dif1", 1.8],
+                ["seattle", "topeka", "dif2", 2.8],
+                ["san-diego", "new-york", "dif1", 2.5],
+                ["san-diego", "new-york", "dif2", 3.5],
+                ["san-diego", "chicago", "dif1", 1.8],
+                ["san-diego", "chicago", "dif2", 2.8],
+                ["san-diego", "topeka", "dif1", 1.4],
+                ["san-diego", "topeka", "dif2", 2.4],
+            ],
+            "x": [
+                ["seattle", "new-york", "dif1", 50.0, 0.0, 0.0, float("inf"), 1.0],
+                ["seattle", "new-york", "dif2", 150.0, 0.0, 0.0, float("inf"), 1.0],
+                ["seattle", "chicago", "dif1", 300.0, 0.0, 0.0, float("inf"), 1.0],
+                ["seattle", "chicago", "dif2", 400.0, 0.0, 0.0, float("inf"), 1.0],
+                ["san-diego", "new-york", "dif1", 275.0, 0.0, 0.0, float("inf"), 1.0],
+                ["san-diego", "new-york", "dif2", 375.0, 0.0, 0.0, float("inf"), 1.0],
+                ["san-diego", "topeka", "dif1", 275.0, 0.0, 0.0, float("inf"), 1.0],
+                ["san-diego", "topeka", "dif2", 375.0, 0.0, 0.0, float("inf"), 1.0],
+            ],
+            "FilesCompared": [
+                ["File1", self.FILE_PATHS["full_example"]],
+                ["File2", self.FILE_PATHS["full_example_changed_data_and_variables"]],
+            ],
+        }
+        self.check_gdx_file(symbols)
+
     def test_full_example_and_full_example_changed_data_and_variables_id_x(
         self,
     ) -> None:
@@ -863,6 +935,60 @@ class TestGdxDiff(unittest.TestCase):
         }
         self.check_gdx_file(symbols)
 
+    # Identical symbols are recognized from their stored data and skipped
+    def test_full_example_and_full_example_copy(self) -> None:
+        output = self.run_gdxdiff(
+            [
+                self.FILE_PATHS["full_example"],
+                self.FILE_PATHS["full_example_copy"],
+                self.FILE_PATHS["diff_file"],
+            ]
+        )
+        self.check_output(
+            output,
+            return_code=0,
+            first_offset=3,
+            second_offset=3,
+            first_delete=[-3],
+            second_delete=[-3],
+        )
+
+        symbols: GamsSymbols = {
+            "FilesCompared": [
+                ["File1", self.FILE_PATHS["full_example"]],
+                ["File2", self.FILE_PATHS["full_example_copy"]],
+            ]
+        }
+        self.check_gdx_file(symbols)
+
+    def test_full_example_and_full_example_copy_threads(self) -> None:
+        output = self.run_gdxdiff(
+            [
+                self.FILE_PATHS["full_example"],
+                self.FILE_PATHS["full_example_copy"],
+                self.FILE_PATHS["diff_file"],
+                "Eps=0.5",
+                "Threads=4",
+            ]
+        )
+        self.check_output(
+            output,
+            return_code=0,
+            file_name="full_example_and_full_example_copy.txt",
+            first_offset=3,
+            second_offset=3,
+            first_delete=[-3],
+            second_delete=[-3],
+        )
+
+        symbols: GamsSymbols = {
+            "FilesCompared": [
+                ["File1", self.FILE_PATHS["full_example"]],
+                ["File2", self.FILE_PATHS["full_example_copy"]],
+            ]
+        }
+        self.check_gdx_file(symbols)
+
     def test_default_values_example_1_and_default_values_example_2(self) -> None:
         output = self.run_gdxdiff(
             [
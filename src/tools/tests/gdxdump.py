@@ -1,4 +1,7 @@
+import gzip
+import json
 import os
+import struct
 import subprocess
 import tempfile
 import unittest
@@ -11,6 +14,7 @@ from .common import (
     check_output,
     run_executable,
 )
+from .examples.acronym_example import create_acronym_example
 from .examples.element_text_example import create_element_text_example
 from .examples.full_example import create_full_example
 from .examples.label_example import create_label_example
@@ -27,6 +31,7 @@ class TestGdxDump(unittest.TestCase):
         "element_text_example",
         "special_values_example",
         "label_example",
+        "acronym_example",
     ]
     FILE_PATHS: dict[str, Path]
 
@@ -42,6 +47,7 @@ class TestGdxDump(unittest.TestCase):
         create_element_text_example(cls.FILE_PATHS["element_text_example"])
         create_special_values_example(cls.FILE_PATHS["special_values_example"])
         create_label_example(cls.FILE_PATHS["label_example"])
+        create_acronym_example(cls.FILE_PATHS["acronym_example"])
 
     @classmethod
     def tearDownClass(cls) -> None:
@@ -114,6 +120,33 @@ class TestGdxDump(unittest.TestCase):
             self.assertEqual(output.stdout, "")
             self.assertEqual(output.stderr, "")
 
+    def test_full_example_threads(self) -> None:
+        output = self.run_gdxdump([self.FILE_PATHS["full_example"], "Threads=4"])
+        self.check_output(output, file_name="full_example.txt")
+
+    def test_full_example_gzip(self) -> None:
+        with tempfile.TemporaryDirectory() as temporary_directory:
+            for threads in ["1", "4"]:
+                with self.subTest(threads=threads):
+                    output_path = Path(temporary_directory) / f"full_example_{threads}.txt.gz"
+                    output = self.run_gdxdump(
+                        [
+                            self.FILE_PATHS["full_example"],
+                            f"Output={output_path}",
+                            f"Threads={threads}",
+                        ]
+                    )
+                    self.assertEqual(output.returncode, 0)
+                    self.assertEqual(output.stdout, "")
+                    self.assertEqual(output.stderr, "")
+                    with gzip.open(output_path, "rt") as file:
+                        first = file.read().split("\n")
+                    with open(
+                        DIRECTORY_PATHS.output.gdxdump / "full_example.txt", "r"
+                    ) as file:
+                        second = file.read().split("\n")
+                    self.assertEqual(first, second)
+
     def test_full_example_version(self) -> None:
         output = self.run_gdxdump([self.FILE_PATHS["full_example"], "-Version"])
         self.check_output(output, first_offset=1, second_offset=1)
@@ -195,6 +228,64 @@ class TestGdxDump(unittest.TestCase):
         output = self.run_gdxdump([self.FILE_PATHS["full_example"], "Format=csv"])
         self.check_output(output, return_code=1)
 
+    def test_full_example_format_columnar(self) -> None:
+        with tempfile.TemporaryDirectory() as directory_name:
+            output = self.run_gdxdump(
+                [
+                    self.FILE_PATHS["full_example"],
+                    "Format=columnar",
+                    f"Output={directory_name}",
+                ]
+            )
+            self.assertEqual(output.returncode, 0)
+            self.assertEqual(output.stdout, "")
+            self.assertEqual(output.stderr, "")
+            directory = Path(directory_name)
+            with open(directory / "manifest.json", "r") as file:
+                manifest = json.load(file)
+            uels = (directory / "uels.txt").read_text().split("\n")[:-1]
+            self.assertEqual(len(uels), manifest["uels"]["count"])
+            symbol = next(s for s in manifest["symbols"] if s["name"] == "d")
+            self.assertEqual(symbol["type"], "parameter")
+            self.assertEqual(symbol["domain"], ["i", "j"])
+            self.assertEqual(symbol["records"], 6)
+            columns = {c["name"]: directory / c["file"] for c in symbol["columns"]}
+            first = struct.unpack("<6i", columns["dim1"].read_bytes())
+            second = struct.unpack("<6i", columns["dim2"].read_bytes())
+            self.assertEqual(uels[first[0] - 1], "seattle")
+            self.assertEqual(uels[second[0] - 1], "new-york")
+            values = struct.unpack("<6d", columns["level"].read_bytes())
+            self.assertEqual(values[0], 2.5)
+
+    def test_acronym_example_format_columnar(self) -> None:
+        with tempfile.TemporaryDirectory() as directory_name:
+            output = self.run_gdxdump(
+                [
+                    self.FILE_PATHS["acronym_example"],
+                    "Format=columnar",
+                    f"Output={directory_name}",
+                ]
+            )
+            self.assertEqual(output.returncode, 0)
+            self.assertEqual(output.stdout, "")
+            self.assertEqual(output.stderr, "")
+            directory = Path(directory_name)
+            with open(directory / "manifest.json", "r") as file:
+                manifest = json.load(file)
+            self.assertEqual(
+                manifest["acronyms"]["list"],
+                [{"name": "first", "index": 1}, {"name": "second", "index": 2}],
+            )
+            symbol = next(s for s in manifest["symbols"] if s["name"] == "p")
+            self.assertEqual(symbol["records"], 3)
+            columns = {c["name"]: directory / c["file"] for c in symbol["columns"]}
+            values = struct.unpack("<3d", columns["level"].read_bytes())
+            self.assertEqual(values, (350.0, 1e301, 2e301))
+
+    def test_full_example_format_columnar_missing_output(self) -> None:
+        output = self.run_gdxdump([self.FILE_PATHS["full_example"], "Format=columnar"])
+        self.assertEqual(output.returncode, 1)
+
     def test_full_example_symbol_format_csv(self) -> None:
         output = self.run_gdxdump(
             [self.FILE_PATHS["full_example"], "Symb=a", "Format=csv"]
@@ -0,0 +1,188 @@
+import csv
+import io
+import json
+import os
+import shutil
+import subprocess
+import tempfile
+import unittest
+from pathlib import Path
+
+from .common import (
+    DIRECTORY_PATHS,
+    ExecutableName,
+    check_output,
+    run_executable,
+)
+from .examples.full_example import create_full_example
+from .examples.small_example import create_small_example
+
+
+class TestGdxInfo(unittest.TestCase):
+    EXECUTABLE_NAME: ExecutableName = "gdxinfo"
+
+    FILE_NAMES = [
+        "small_example",
+        "full_example",
+    ]
+    FILE_PATHS: dict[str, Path]
+
+    SMALL_EXAMPLE_SYMBOLS = [
+        {
+            "name": "i",
+            "type": "Set",
+            "dim": 1,
+            "records": 2,
+            "domain": ["*"],
+            "text": "supply",
+        },
+        {
+            "name": "j",
+            "type": "Set",
+            "dim": 1,
+            "records": 3,
+            "domain": ["*"],
+            "text": "markets",
+        },
+        {
+            "name": "d",
+            "type": "Parameter",
+            "dim": 2,
+            "records": 6,
+            "domain": ["i", "j"],
+            "text": "distance in thousands of miles",
+        },
+    ]
+
+    @classmethod
+    def setUpClass(cls) -> None:
+        cls.FILE_PATHS = {
+            file_name: DIRECTORY_PATHS.examples / f"{file_name}.gdx"
+            for file_name in cls.FILE_NAMES
+        }
+
+        create_small_example(cls.FILE_PATHS["small_example"])
+        create_full_example(cls.FILE_PATHS["full_example"])
+
+    @classmethod
+    def tearDownClass(cls) -> None:
+        for file_path in cls.FILE_PATHS.values():
+            os.remove(file_path)
+
+    @classmethod
+    def run_gdxinfo(cls, command: list[str | Path]) -> subprocess.CompletedProcess[str]:
+        return run_executable(cls.EXECUTABLE_NAME, command)
+
+    def test_empty_command(self) -> None:
+        output = self.run_gdxinfo([])
+        check_output(
+            self,
+            self.EXECUTABLE_NAME,
+            output,
+            return_code=1,
+            file_name="usage.txt",
+            first_offset=None,
+            first_negative_offset=None,
+            second_offset=None,
+            second_negative_offset=None,
+            first_delete=[1],
+            second_delete=[1],
+        )
+
+    def test_small_example_json(self) -> None:
+        output = self.run_gdxinfo([self.FILE_PATHS["small_example"], "Format=json"])
+        self.assertEqual(output.returncode, 0)
+        self.assertEqual(output.stderr, "")
+        catalog = json.loads(output.stdout)
+        self.assertEqual(len(catalog), 1)
+        self.assertEqual(catalog[0]["file"], str(self.FILE_PATHS["small_example"]))
+        self.assertEqual(catalog[0]["symbols"], self.SMALL_EXAMPLE_SYMBOLS)
+        self.assertNotIn("error", catalog[0])
+
+    def test_small_example_csv(self) -> None:
+        output = self.run_gdxinfo([self.FILE_PATHS["small_example"]])
+        self.assertEqual(output.returncode, 0)
+        self.assertEqual(output.stderr, "")
+        rows = list(csv.DictReader(io.StringIO(output.stdout)))
+        self.assertEqual(
+            [
+                (row["Symbol"], row["Type"], row["Dim"], row["Records"], row["Domain"])
+                for row in rows
+            ],
+            [
+                ("i", "Set", "1", "2", "*"),
+                ("j", "Set", "1", "3", "*"),
+                ("d", "Parameter", "2", "6", "i,j"),
+            ],
+        )
+        self.assertTrue(all(row["Error"] == "" for row in rows))
+
+    def test_directory(self) -> None:
+        with tempfile.TemporaryDirectory() as temporary_directory:
+            directory = Path(temporary_directory)
+            (directory / "sub").mkdir()
+            shutil.copy(self.FILE_PATHS["small_example"], directory / "b.gdx")
+            shutil.copy(self.FILE_PATHS["full_example"], directory / "sub" / "a.gdx")
+            (directory / "notes.txt").write_text("not a gdx file")
+            for threads in ["1", "4"]:
+                with self.subTest(threads=threads):
+                    output = self.run_gdxinfo(
+                        [directory, "Format=json", f"Threads={threads}"]
+                    )
+                    self.assertEqual(output.returncode, 0)
+                    catalog = json.loads(output.stdout)
+                    self.assertEqual(
+                        [entry["file"] for entry in catalog],
+                        [str(directory / "b.gdx"), str(directory / "sub" / "a.gdx")],
+                    )
+                    self.assertEqual(catalog[0]["symbols"], self.SMALL_EXAMPLE_SYMBOLS)
+
+    def test_unreadable_file(self) -> None:
+        with tempfile.TemporaryDirectory() as temporary_directory:
+            bad_file = Path(temporary_directory) / "bad.gdx"
+            bad_file.write_text("not a gdx file")
+            output = self.run_gdxinfo(
+                [self.FILE_PATHS["small_example"], bad_file, "Format=json"]
+            )
+            self.assertEqual(output.returncode, 4)
+            catalog = json.loads(output.stdout)
+            self.assertEqual(len(catalog), 2)
+            self.assertEqual(catalog[1]["file"], str(bad_file))
+            self.assertIn("error", catalog[1])
+            self.assertEqual(
+                output.stderr, "*** Error: 1 of 2 files could not be read\n"
+            )
+
+    def test_unreadable_file_csv(self) -> None:
+        with tempfile.TemporaryDirectory() as temporary_directory:
+            bad_file = Path(temporary_directory) / "bad.gdx"
+            bad_file.write_text("not a gdx file")
+            output = self.run_gdxinfo([self.FILE_PATHS["small_example"], bad_file])
+            self.assertEqual(output.returncode, 4)
+            lines = list(csv.reader(io.StringIO(output.stdout)))
+            self.assertTrue(all(len(line) == len(lines[0]) for line in lines))
+            rows = list(csv.DictReader(io.StringIO(output.stdout)))
+            self.assertEqual(len(rows), 4)
+            self.assertTrue(all(row["Error"] == "" for row in rows[:3]))
+            self.assertEqual(rows[3]["File"], str(bad_file))
+            self.assertEqual(rows[3]["Text"], "")
+            self.assertNotEqual(rows[3]["Error"], "")
+            self.assertEqual(
+                output.stderr, "*** Error: 1 of 2 files could not be read\n"
+            )
+
+    def test_output(self) -> None:
+        with tempfile.TemporaryDirectory() as temporary_directory:
+            output_path = Path(temporary_directory) / "catalog.json"
+            output = self.run_gdxinfo(
+                [
+                    self.FILE_PATHS["small_example"],
+                    "Format=json",
+                    f"Output={output_path}",
+                ]
+            )
+            self.assertEqual(output.returncode, 0)
+            self.assertEqual(output.stdout, "")
+            with open(output_path, "r") as file:
+                catalog = json.load(file)
+            self.assertEqual(catalog[0]["symbols"], self.SMALL_EXAMPLE_SYMBOLS)
@@ -6,6 +6,9 @@ import yaml2doxy
 
 
 def maybe_deref(arg_name, arg_type, deref_char='*'):
+    if arg_type == 'Oint64':
+        # INT64 and int64_t have the same size but can be distinct types (long vs. long long)
+        return f'*reinterpret_cast<int64_t *>( {arg_name} )' if deref_char == '*' else f'reinterpret_cast<INT64 *>( &{arg_name} )'
     return (deref_char if arg_type == 'Oint' else '') + arg_name
 
 
@@ -66,6 +66,7 @@ def map_type_gen(func_ptrs, for_cpp=True):
                     int='int',
                     vII='int *',
                     Oint='int &' if for_cpp else 'int *',
+                    Oint64='int64_t &' if for_cpp else 'INT64 *',
                     oSI='char **',
                     cRV='const double *',
                     vRV='double *',
@@ -74,7 +75,9 @@ def map_type_gen(func_ptrs, for_cpp=True):
                     cSVA='const double *',
                     ptr='void *',
                     D='double',
-                    int64='int64_t' if for_cpp else 'INT64')
+                    int64='int64_t' if for_cpp else 'INT64',
+                    AllocProc='gdlib::gmsalloc::TAllocProc' if for_cpp else 'TgdxAllocProc_t',
+                    FreeProc='gdlib::gmsalloc::TFreeProc' if for_cpp else 'TgdxFreeProc_t')
 
     func_ptr_types = {
         func_name: func_attrs['function'] + '_t'